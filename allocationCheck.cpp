@@ -0,0 +1,144 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: allocationCheck.cpp checks that a steady state simulation performs no heap allocations. Every operator new
+ *              of the program is counted. The inputFiles scenario plus a dense field of moving targets is run frame by frame
+ *              (radar::stepFrame()) with track storage reserved ahead of time (radar::reserveTracks()), once with the default
+ *              tracking and once with measurement association, track coasting, plot extraction, false alarms, range culling
+ *              and illumination scheduling. After a warm-up, during which per-frame storage grows to its working size, any
+ *              allocation made by a frame fails the check. Detections are consumed through callbacks (search history off),
+ *              since stored history grows with every detection unless reserved (radar::reserveSearchHistory()).
+ *                 g++ -O2 -std=c++17 -pthread allocationCheck.cpp -o allocationCheck
+ *                 ./allocationCheck [targets] [warm-up frames] [frames]
+ *              Returns 0 if no frame after warm-up allocated, 1 otherwise.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "configManager.h"
+#include <stdio.h>
+#include <atomic>
+#include <new>
+
+using namespace std;
+
+static atomic<long> allocationCount(0);   //Allocations made by program
+
+void* operator new(size_t size){
+   allocationCount.fetch_add(1, memory_order_relaxed);
+   void* memory = malloc((size > 0) ? size : 1);
+   if(memory == NULL){
+      throw bad_alloc();
+   }
+   return memory;
+}
+
+void* operator new[](size_t size){
+   return operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+   free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+   free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+   free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept {
+   free(memory);
+}
+
+//Counts records handed out, so detections/track events are consumed as they would be by a caller
+void countDetection(const searchDetectRecord &, void* userData){
+   *(long*)userData = *(long*)userData + 1;
+}
+
+void countTrackEvent(const trackEventRecord &, void* userData){
+   *(long*)userData = *(long*)userData + 1;
+}
+
+void countPlot(const plotRecord &, void* userData){
+   *(long*)userData = *(long*)userData + 1;
+}
+
+//Runs scenario frame by frame. Returns amount of allocations made after warm-up
+long runScenario(const char* name, int targetCount, int warmupFrames, int frames, bool allFeatures){
+   srand(7);
+   configManager config;
+   config.inputRadarFile("inputFiles/RadarInfo.txt");
+   config.inputFaceFile("inputFiles/FaceInfo.txt");
+   config.inputSectorFile("inputFiles/SectorInfo.txt");
+   config.inputTargetFile("inputFiles/TargetInfo.txt");
+
+   radar simRadar;
+   config.initializeInputData(simRadar);
+   simRadar.setConsoleOutput(false);
+   simRadar.setStoreSearchHistory(false);
+   long records = 0;
+   simRadar.setDetectionCallback(countDetection, &records);
+   simRadar.setTrackEventCallback(countTrackEvent, &records);
+   if(allFeatures == true){
+      simRadar.setMeasurementAssociation(true);
+      simRadar.setTrackCoasting(2);
+      simRadar.setPlotExtraction(true);
+      simRadar.setPlotCallback(countPlot, &records);
+      simRadar.setFalseAlarmGeneration(true);
+      simRadar.setRangeCulling(true);
+      simRadar.setIlluminationScheduling(true);
+      const vector<radarFace*> &faceVector = simRadar.getRadarFaceVector();
+      for(int faceIter = 0; faceIter < faceVector.size(); faceIter++){
+         const vector<searchSector*> &sectorVector = faceVector[faceIter]->getSearchSectorVector();
+         for(int sectorIter = 0; sectorIter < sectorVector.size(); sectorIter++){
+            sectorVector[sectorIter]->setFalseAlarms(1e-4, sectorVector[sectorIter]->getRangeCellSize() * units::m);
+         }
+      }
+   }
+   for(int targetIter = 0; targetIter < targetCount; targetIter++){
+      target* fieldTarget = new target;
+      double startKm[3] = {(rand() % 800) - 400.0, (rand() % 800) - 400.0, (rand() % 100)*1.0};
+      fieldTarget->initializePOS(startKm);
+      fieldTarget->setVelocityVector(rand() % 200 - 100, rand() % 200 - 100, 0);
+      fieldTarget->setAccelerationVector(0, 0, 0);
+      fieldTarget->setRCS(1 * units::dB);
+      simRadar.addTarget(*fieldTarget);
+   }
+   simRadar.reserveTracks(simRadar.getTargetVector().size()); //At most one live track per target
+
+   simRadar.beginSimulation();
+   long steadyAllocations = 0;
+   int allocatingFrames = 0;
+   for(int frameIter = 0; frameIter < warmupFrames + frames; frameIter++){
+      long before = allocationCount.load(memory_order_relaxed);
+      simRadar.stepFrame();
+      long made = allocationCount.load(memory_order_relaxed) - before;
+      if(frameIter >= warmupFrames && made > 0){
+         if(allocatingFrames < 10){
+            printf("%s: frame %d made %ld allocation(s)\n", name, frameIter, made);
+         }
+         steadyAllocations = steadyAllocations + made;
+         allocatingFrames = allocatingFrames + 1;
+      }
+   }
+   simRadar.endSimulation();
+   printf("%s: %ld records, %ld allocation(s) in %d frame(s) after %d warm-up frames\n", name, records, steadyAllocations, frames, warmupFrames);
+   return steadyAllocations;
+}
+
+int main(int argc, char** argv){
+   int targetCount = (argc > 1) ? atoi(argv[1]) : 3000;
+   int warmupFrames = (argc > 2) ? atoi(argv[2]) : 20;
+   int frames = (argc > 3) ? atoi(argv[3]) : 300;
+
+   long allocations = runScenario("default", targetCount, warmupFrames, frames, false);
+   allocations = allocations + runScenario("all features", targetCount, warmupFrames, frames, true);
+   if(allocations > 0){
+      cout << "Steady state simulation allocated" << endl;
+      return 1;
+   }
+   cout << "No allocations after warm-up" << endl;
+   return 0;
+}
@@ -0,0 +1,163 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: antennaPattern.h contains the antenna gain losses of search and track beams. By default a beam has full gain
+ *              anywhere inside its 3dB beamwidth (rectangular pattern) at any scan position. Optionally:
+ *                 Beam pattern loss: two-way loss of a target off beam center, from a separable az/el pattern normalized so
+ *                 one-way gain is -3dB at half the beamwidth.
+ *                    sinc^2:   one-way gain = (sin(x)/x)^2, x = 2.7831*offset/beamwidth
+ *                    Gaussian: one-way gain = exp(-4*ln2*(offset/beamwidth)^2)
+ *                 Scan loss: loss of a phased array beam steered theta off the face's boresight, cos^n(theta) in gain
+ *                    loss = -10*n*log10(cos(theta)), cos(theta) = cos(el)cos(el_b)cos(az - az_b) + sin(el)sin(el_b)
+ *              Both are tabulated when the simulation starts so beams add a loss with table lookups instead of trig per target:
+ *              the pattern loss over normalized offset (shared by every face and by track beams), the scan loss per face over
+ *              azimuth off boresight and elevation on a 1 degree grid, interpolated linearly/bilinearly.
+ *              Losses only lower SNR, so range culling and illumination scheduling stay conservative.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef ANTENNAPATTERN_H
+#define ANTENNAPATTERN_H
+#include "simulationPlan.h"
+#include <vector>
+#include <memory>
+#include <iostream>
+#include <math.h>
+
+using namespace std;
+
+//Antenna beam pattern shapes
+enum antennaPatternShape {
+   PATTERN_RECTANGULAR = 0,   //Full gain inside beamwidth (no pattern loss)
+   PATTERN_SINC2 = 1,         //Uniformly illuminated aperture
+   PATTERN_GAUSSIAN = 2       //Gaussian beam
+};
+
+class antennaPattern {
+   public:
+      antennaPattern(){
+         shape = PATTERN_RECTANGULAR;
+         scanLossExponent = 0;
+         builtPlan.reset();
+      }
+      ~antennaPattern(){}
+
+      //Sets beam pattern shape and scan loss exponent n of cos^n(theta), 0 = no scan loss. Exits on negative exponent
+      void configure(antennaPatternShape patternShape, double exponent){
+         if(exponent < 0){
+            cout << "Error, scan loss exponent must not be negative" << endl;
+            exit(1);
+         }
+         shape = patternShape;
+         scanLossExponent = exponent;
+         builtPlan.reset(); //Tables are built again
+      }
+
+      //Gets bool determining if beams have any antenna loss
+      bool isEnabled(){
+         return shape != PATTERN_RECTANGULAR || scanLossExponent > 0;
+      }
+
+      //Gets bool determining if tables are built for plan. The plan tables were built for is held, so a later plan can never
+      //reuse its address
+      bool isBuiltFor(const shared_ptr<const simulationPlan> &plan){
+         return builtPlan == plan;
+      }
+
+      //Function tabulates pattern loss and every face's scan loss of a compiled plan
+      void build(const shared_ptr<const simulationPlan> &compiledPlan){
+         builtPlan = compiledPlan;
+         const simulationPlan &plan = *compiledPlan;
+         patternLoss.assign(PATTERN_POINTS + 1, 0);
+         for(int pointIter = 0; pointIter <= PATTERN_POINTS; pointIter++){
+            double offset = pointIter*PATTERN_SPAN/PATTERN_POINTS; //Offset from beam center (beamwidths)
+            double gain = 1;                                         //One-way power gain
+            if(shape == PATTERN_SINC2 && offset > 0){
+               double x = 2*SINC2_HALF_POWER*offset;
+               gain = pow(sin(x)/x, 2);
+            }
+            else if(shape == PATTERN_GAUSSIAN){
+               gain = exp(-4*log(2)*offset*offset);
+            }
+            patternLoss[pointIter] = -20*log10(max(gain, 1e-6)); //Two-way
+         }
+
+         faces.resize(plan.getFaceCount());
+         for(int faceIter = 0; faceIter < plan.getFaceCount(); faceIter++){
+            const facePlan &faceEntry = plan.getFace(faceIter);
+            faceTable &table = faces[faceIter];
+            table.boresight[0] = faceEntry.boresight[0];
+            table.boresight[1] = faceEntry.boresight[1];
+            table.scanLoss.assign(SCAN_AZ_POINTS*SCAN_EL_POINTS, 0);
+            if(scanLossExponent == 0){
+               continue;
+            }
+            double boresightEl = faceEntry.boresight[1]*M_PI/180;
+            for(int elIter = 0; elIter < SCAN_EL_POINTS; elIter++){
+               double el = (elIter*SCAN_STEP - 90)*M_PI/180;
+               for(int azIter = 0; azIter < SCAN_AZ_POINTS; azIter++){
+                  double azOff = (azIter*SCAN_STEP - 180)*M_PI/180;
+                  double cosTheta = cos(el)*cos(boresightEl)*cos(azOff) + sin(el)*sin(boresightEl);
+                  table.scanLoss[elIter*SCAN_AZ_POINTS + azIter] = -10*scanLossExponent*log10(max(cosTheta, MIN_COS_SCAN));
+               }
+            }
+         }
+      }
+
+      //Function gives antenna loss of a beam steered to (beamAz, beamEl) on a face for a target offset from beam center
+      //Inputs: offsetAz/offsetEl = target position - beam position. beamWidth = 3dB beamwidth. 0 = azimuth. 1 = elevation
+      //Units: degrees, returns decible
+      double getLoss(int faceIter, double beamAz, double beamEl, double offsetAz, double offsetEl, const double beamWidth[2]){
+         return lookupPattern(fabs(offsetAz)/beamWidth[0]) + lookupPattern(fabs(offsetEl)/beamWidth[1]) + lookupScan(faceIter, beamAz, beamEl);
+      }
+
+   private:
+      static const int PATTERN_POINTS = 1024;            //Pattern table intervals
+      static constexpr double PATTERN_SPAN = 1.0;        //Pattern table covers 0 to one beamwidth off center, clamped beyond
+      static constexpr double SINC2_HALF_POWER = 1.39156; //x where (sin(x)/x)^2 = 0.5
+      static constexpr double SCAN_STEP = 1.0;           //Scan loss grid step. (degrees)
+      static const int SCAN_AZ_POINTS = 361;             //-180 to 180 degrees off boresight azimuth
+      static const int SCAN_EL_POINTS = 181;             //-90 to 90 degrees elevation
+      static constexpr double MIN_COS_SCAN = 1e-3;       //Scan loss is capped at cos(theta) = 1e-3 (beams steered behind face)
+
+      //Scan loss table of one face
+      struct faceTable {
+         double boresight[2];          //Face boresight. 0 = azimuth. 1 = elevation. (degrees)
+         vector<double> scanLoss;      //Scan loss by elevation row and azimuth off boresight. (decible)
+      };
+
+      //Function interpolates two-way pattern loss at an offset in beamwidths
+      double lookupPattern(double offset){
+         double position = min(offset, PATTERN_SPAN)*(PATTERN_POINTS/PATTERN_SPAN);
+         int point = min((int)position, PATTERN_POINTS - 1);
+         double fraction = position - point;
+         return patternLoss[point] + fraction*(patternLoss[point + 1] - patternLoss[point]);
+      }
+
+      //Function interpolates a face's scan loss at a beam position
+      double lookupScan(int faceIter, double beamAz, double beamEl){
+         if(scanLossExponent == 0){
+            return 0;
+         }
+         const faceTable &table = faces[faceIter];
+         double azOff = fmod(beamAz - table.boresight[0] + 540, 360) - 180;
+         if(azOff < -180) azOff = azOff + 360;
+         double azPosition = (azOff + 180)/SCAN_STEP;
+         double elPosition = (min(max(beamEl, -90.0), 90.0) + 90)/SCAN_STEP;
+         int azPoint = min((int)azPosition, SCAN_AZ_POINTS - 2);
+         int elPoint = min((int)elPosition, SCAN_EL_POINTS - 2);
+         double azFraction = azPosition - azPoint;
+         double elFraction = elPosition - elPoint;
+         const double* row = &table.scanLoss[elPoint*SCAN_AZ_POINTS + azPoint];
+         double low = row[0] + azFraction*(row[1] - row[0]);
+         double high = row[SCAN_AZ_POINTS] + azFraction*(row[SCAN_AZ_POINTS + 1] - row[SCAN_AZ_POINTS]);
+         return low + elFraction*(high - low);
+      }
+
+      antennaPatternShape shape;          //Beam pattern shape
+      double scanLossExponent;            //Exponent n of cos^n(theta) scan loss
+      shared_ptr<const simulationPlan> builtPlan; //Plan tables were built for, NULL before tables are built
+      vector<double> patternLoss;         //Two-way pattern loss by offset from beam center. (decible)
+      vector<faceTable> faces;            //Scan loss table of every face
+};
+
+#endif
@@ -1,11 +1,17 @@
 /*/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
  * Unclassified
  * Coder: Weston Yohe
- * Last Modified: 8/10/2022
+ * Last Modified: 10/19/2026
  * Description:  configManager.h is responsible for "file" handling. It contains the logic to input .txt files and
  *               sort/gather the data contained in the inputted .txt file. This class then calls other classes setter/getter functions
  *               to assign the data gathered from the .txt files. This class also contains functions to output post-
- *               simulation results/data to a user-specified .txt file.
+ *               simulation results/data to a user-specified .txt file. A simulation can also be initialized from an in-memory
+ *               scenario (scenario.h) instead of .txt files. Recorded target trajectories are inputted from a binary waypoint
+ *               file (waypointFile.h), which stays memory-mapped for the lifetime of the configManager. Once a radar is configured,
+ *               its faces and search sectors are compiled into a read-only simulation plan (simulationPlan.h).
+ *               Faces and search sectors are allocated in flat tables owned by the configManager (one face table and one sector
+ *               table per configured radar, each face's sectors consecutive), so any amount of faces/sectors can be configured.
+ *               The configManager must outlive the radars it configured.
  */////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifndef CONFIGMANAGER_H
 #define CONFIGMANAGER_H
@@ -13,10 +19,14 @@
 #include "radarFace.h"
 #include "searchSector.h"
 #include "target.h"
+#include "scenario.h"
+#include "trajectoryTarget.h"
+#include "waypointFile.h"
 #include <iostream>
 #include <fstream>
 #include <string.h> 
 #include <vector>
+#include <memory>
 
 using namespace std;
 
@@ -61,6 +71,12 @@ class configManager {
             }                  
         }
 
+ 
+        //Memory-maps binary waypoint file containing recorded target trajectories (optional). Additionally checks for errors in opening file
+        void inputTrajectoryFile(string fileName){
+            trajectoryData.openFile(fileName);
+        }
+
         //Gets ifstream object handling .txt file for radar.h parameters 
         ifstream& getRadarIfstream(){
             return radarData;
@@ -158,32 +174,51 @@ class configManager {
             initializeFaceData(radarSim);
             initializeSectorData(radarSim);
             intializeTargetData(radarSim);
+            initializeTrajectoryData(radarSim);
+            compileSimulationPlan(radarSim);
        }
 
+        //Function initializes radar, face and sector parameters found in .txt files without any targets. Used to configure further sites
+        //of a radar network (radarNetwork.h) from their own radar files, targets are then only added through the network
+        void initializeSiteData(radar &radarSim){
+            initializeRadarData(radarSim, false);
+            initializeFaceData(radarSim);
+            initializeSectorData(radarSim);
+            compileSimulationPlan(radarSim);
+       }
+
+        //Function compiles radar's configured faces and search sectors into a validated, read-only simulation plan (simulationPlan.h)
+        //and hands it to the radar. The plan can be shared with other radars configured with the same faces/sectors (radar::setSimulationPlan)
+        shared_ptr<const simulationPlan> compileSimulationPlan(radar &radarSim){
+            radarSim.compileSimulationPlan();
+            return radarSim.getSimulationPlan();
+        }
+
         //Function gathers radar.h .txt data  and calls radar.h setter funcetions to initialize parameters
-        void initializeRadarData(radar &radarSim){
+        //Input: createTargets = false skips creating the targets listed by target amount (radar network sites, see initializeSiteData)
+        void initializeRadarData(radar &radarSim, bool createTargets = true){
             //Collecting face amount
             temp = collectSingleLineData(radarData);
-            if(temp > 8){
-                cout << "Error, too many input radar face's " <<endl;
+            if(temp < 1){
+                cout << "Error, radar needs at least one radar face " <<endl;
                 exit(1); 
             }
+            radarFace* faceTable = allocateFaceTable(temp);
             for(int i = 0; i < temp; i++){
-                radarFace* face = new radarFace;
-                radarSim.addRadarFace(*face);
+                radarSim.addRadarFace(faceTable[i]);
             }
             //Collecting target amount
             temp = collectSingleLineData(radarData);
-            for(int i = 0; i < temp; i++){
+            for(int i = 0; i < temp && createTargets == true; i++){
                 target* radarTarget = new target;
                 radarSim.addTarget(*radarTarget);
             }
             //Tracking PRF
             temp = collectSingleLineData(radarData);
-            radarSim.setTrackPRF(temp);
+            radarSim.setTrackPRF(temp * units::kHz);
             //Tracking SNRmin
             temp = collectSingleLineData(radarData);
-            radarSim.setTrackingSNRmin(temp);
+            radarSim.setTrackingSNRmin(temp * units::dB);
             //Tracking Beamwidth
             tempPointer = collectInputAngles(radarData);
             radarSim.setTrackBeamwidth(tempPointer);
@@ -192,86 +227,105 @@ class configManager {
             radarSim.setA_B_gammaWeights(tempPointer);
             //Simulation Refresh Interval/Rate
             temp = collectSingleLineData(radarData);
-            radarSim.setRefreshRate(temp);
+            radarSim.setRefreshRate(temp * units::s);
             //Radar Simulation Time
             temp = collectSingleLineData(radarData);
-            radarSim.setSimLength(temp);
+            radarSim.setSimLength(temp * units::min);
+            //Radar site position (optional, site is at origin when missing)
+            tempPointer = collectCoordinateData(radarData);
+            radarSim.setSitePosition(tempPointer[0] * units::km, tempPointer[1] * units::km, tempPointer[2] * units::km);
+            //Radar site heading (optional, 0 when missing)
+            temp = collectSingleLineData(radarData);
+            radarSim.setSiteHeading(temp * units::deg);
         }
 
         //Function gathers radarFace.h .txt data and calls radarFace.h setter funcetions to initialize parameters
         void initializeFaceData(radar &radarSim){
-            vector<radarFace*> faceVector = radarSim.getRadarFaceVector();
+            const vector<radarFace*> &faceVector = radarSim.getRadarFaceVector();
+            vector<int> sectorCounts(faceVector.size()); //Amount of search sectors of every face
             for(int i = 0; i < faceVector.size(); i++){
                 //Boresight
                 tempPointer = collectInputAngles(faceData);
-                faceVector[i]->setBoresight(tempPointer[0],tempPointer[1]);
+                faceVector[i]->setBoresight(tempPointer[0] * units::deg, tempPointer[1] * units::deg);
                 //Azimuth FOV
                 tempPointer = collectInputAngles(faceData);
-                faceVector[i]->setAzExtent(tempPointer[0],tempPointer[1]);
+                faceVector[i]->setAzExtent(tempPointer[0] * units::deg, tempPointer[1] * units::deg);
                 //Elevation FOV
                 tempPointer = collectInputAngles(faceData);
-                faceVector[i]->setElExtent(tempPointer[0],tempPointer[1]);
+                faceVector[i]->setElExtent(tempPointer[0] * units::deg, tempPointer[1] * units::deg);
                  //Searching half power beamwidth
                 tempPointer = collectInputAngles(faceData);
-                faceVector[i]->setHalfPowerBeamWidth(tempPointer[0],tempPointer[1]);
+                faceVector[i]->setHalfPowerBeamWidth(tempPointer[0] * units::deg, tempPointer[1] * units::deg);
                 //Minimum detectable SNR value
                 temp = collectSingleLineData(faceData);
-                faceVector[i]->setSNRmin(temp);
+                faceVector[i]->setSNRmin(temp * units::dB);
                 //Wave frequency
                 temp = collectSingleLineData(faceData);
-                faceVector[i]->setWaveFreq(temp);
+                faceVector[i]->setWaveFreq(temp * units::GHz);
                 //Wave Bandwidth
                 temp = collectSingleLineData(faceData);
-                faceVector[i]->setBandwidth(temp);
+                faceVector[i]->setBandwidth(temp * units::kHz);
                 //Effective attena area
                 temp = collectSingleLineData(faceData);
                 faceVector[i]->setEffectiveAttenaArea(temp);
                 //Peak Power
                 temp = collectSingleLineData(faceData);
-                faceVector[i]->setPeakPower(temp);
+                faceVector[i]->setPeakPower(temp * units::kW);
                 //Noise Figure
                 temp = collectSingleLineData(faceData);
-                faceVector[i]->setNoiseFigure(temp);
+                faceVector[i]->setNoiseFigure(temp * units::dB);
                 //TotalSystemLoss
                 temp = collectSingleLineData(faceData);
-                faceVector[i]->setTotalSysLoss(temp);
+                faceVector[i]->setTotalSysLoss(temp * units::dB);
                 //Amount of search sectors for radar face
                 temp = collectSingleLineData(faceData);
-                if(temp>10){
-                cout << "Error, too many search sector's " <<endl;
+                if(temp < 1){
+                cout << "Error, radar face needs at least one search sector " <<endl;
                 exit(1); 
                 }
-                for(int j = 0; j < temp; j++){
-                    searchSector* sector = new searchSector;
-                    faceVector[i]->addSearchSector(*sector);
-                }
+                sectorCounts[i] = temp;
 
                 //Initialization functions
                 //Initializing power average 
                 faceVector[i]->initializePowerAvg(radarSim.getTrackPRF());
             }
+
+            //Every face's search sectors are handed out consecutively from one sector table
+            int sectorTotal = 0;
+            for(int i = 0; i < faceVector.size(); i++){
+                sectorTotal = sectorTotal + sectorCounts[i];
+            }
+            searchSector* sectorTable = allocateSectorTable(sectorTotal);
+            for(int i = 0; i < faceVector.size(); i++){
+                for(int j = 0; j < sectorCounts[i]; j++){
+                    faceVector[i]->addSearchSector(*sectorTable);
+                    sectorTable = sectorTable + 1;
+                }
+            }
         }
 
         //Function gathers searchSector.h .txt data and calls searchSector.h setter funcetions to initialize parameters
         void initializeSectorData(radar &radarSim){
             
-            vector<radarFace*> faceVector = radarSim.getRadarFaceVector();
+            const vector<radarFace*> &faceVector = radarSim.getRadarFaceVector();
             for(int i = 0; i < faceVector.size(); i++){
-                vector<searchSector*> sectorVector = faceVector[i]->getSearchSectorVector();
+                const vector<searchSector*> &sectorVector = faceVector[i]->getSearchSectorVector();
                 for(int j = 0; j < sectorVector.size(); j++){
-                vector<searchSector*> sectorVector = faceVector[i]->getSearchSectorVector();
                 //Azimuth Extent
                 tempPointer = collectInputAngles(sectorData);
-                sectorVector[j]->setAzExtent(tempPointer[0],tempPointer[1]);
+                sectorVector[j]->setAzExtent(tempPointer[0] * units::deg, tempPointer[1] * units::deg);
                 //Elevation Extenet
                 tempPointer = collectInputAngles(sectorData);
-                sectorVector[j]->setElExtent(tempPointer[0],tempPointer[1]);
+                sectorVector[j]->setElExtent(tempPointer[0] * units::deg, tempPointer[1] * units::deg);
                 //Range Extent
                 tempPointer = collectInputAngles(sectorData);
-                sectorVector[j]->setRangeExtent(tempPointer[0],tempPointer[1]);
+                sectorVector[j]->setRangeExtent(tempPointer[0] * units::km, tempPointer[1] * units::km);
                 //Refresh Rate
                 temp = collectSingleLineData(sectorData);
-                sectorVector[j]->setRefreshRate(temp);
+                sectorVector[j]->setRefreshRate(temp * units::s);
+                //Probability of false alarm per range cell (0 = no false alarms)
+                temp = collectSingleLineData(sectorData);
+                sectorVector[j]->setFalseAlarms(temp, sectorVector[j]->getRangeCellSize() * units::m);
 
                 //Initialize functions
                 //Initializing/calculating search sector search volume
@@ -286,7 +340,7 @@ class configManager {
 
         //Function gathers and calls target.h setter funcetions to initialize parameters
         void intializeTargetData(radar &radarSim){
-            vector<target*> targetVector = radarSim.getTargetVector();
+            const vector<target*> &targetVector = radarSim.getTargetVector();
             for(int i = 0; i < targetVector.size(); i++){
                 //Target Starting Coordinates
                 tempPointer = collectCoordinateData(targetData);
@@ -299,21 +353,109 @@ class configManager {
                 targetVector[i]->setAccelerationVector(tempPointer[0],tempPointer[1],tempPointer[2]);
                 //Target RCS
                 temp = collectSingleLineData(targetData);
-                targetVector[i]->setRCS(temp);
+                targetVector[i]->setRCS(temp * units::dB);
             }
         }
 
+        //Function initializes all parameter data from an in-memory scenario instead of .txt files. Same units as .txt files
+        void initializeScenarioData(const scenario &sim, radar &radarSim){
+            //radar.h parameters
+            radarSim.setTrackPRF(sim.trackPRF * units::kHz);
+            radarSim.setTrackingSNRmin(sim.trackingSNRmin * units::dB);
+            double beamwidths[2] = {sim.trackBeamWidth[0], sim.trackBeamWidth[1]};
+            radarSim.setTrackBeamwidth(beamwidths);
+            double weights[3] = {sim.filterWeights[0], sim.filterWeights[1], sim.filterWeights[2]};
+            radarSim.setA_B_gammaWeights(weights);
+            radarSim.setRefreshRate(sim.refreshRate * units::s);
+            radarSim.setSimLength(sim.simLength * units::min);
+            radarSim.setSitePosition(sim.sitePosition[0] * units::km, sim.sitePosition[1] * units::km, sim.sitePosition[2] * units::km);
+            radarSim.setSiteHeading(sim.siteHeading * units::deg);
+
+            //radarFace.h and searchSector.h parameters
+            int sectorTotal = 0;
+            for(int i = 0; i < sim.faces.size(); i++){
+                sectorTotal = sectorTotal + sim.faces[i].sectors.size();
+            }
+            radarFace* faceTable = allocateFaceTable(sim.faces.size());
+            searchSector* sectorTable = allocateSectorTable(sectorTotal);
+            for(int i = 0; i < sim.faces.size(); i++){
+                const faceParams &params = sim.faces[i];
+                radarFace* face = &faceTable[i];
+                face->setBoresight(params.boresight[0] * units::deg, params.boresight[1] * units::deg);
+                face->setAzExtent(params.azExtent[0] * units::deg, params.azExtent[1] * units::deg);
+                face->setElExtent(params.elExtent[0] * units::deg, params.elExtent[1] * units::deg);
+                face->setHalfPowerBeamWidth(params.halfPowerBeamWidth[0] * units::deg, params.halfPowerBeamWidth[1] * units::deg);
+                face->setSNRmin(params.SNRmin * units::dB);
+                face->setWaveFreq(params.waveFreq * units::GHz);
+                face->setBandwidth(params.bandwidth * units::kHz);
+                face->setEffectiveAttenaArea(params.effectiveAttenaArea);
+                face->setPeakPower(params.peakPower * units::kW);
+                face->setNoiseFigure(params.noiseFigure * units::dB);
+                face->setTotalSysLoss(params.totalSysLoss * units::dB);
+                face->initializePowerAvg(radarSim.getTrackPRF());
+
+                for(int j = 0; j < params.sectors.size(); j++){
+                    const sectorParams &sectorIn = params.sectors[j];
+                    searchSector* sector = sectorTable;
+                    sectorTable = sectorTable + 1;
+                    sector->setAzExtent(sectorIn.azExtent[0] * units::deg, sectorIn.azExtent[1] * units::deg);
+                    sector->setElExtent(sectorIn.elExtent[0] * units::deg, sectorIn.elExtent[1] * units::deg);
+                    sector->setRangeExtent(sectorIn.rangeExtent[0] * units::km, sectorIn.rangeExtent[1] * units::km);
+                    sector->setRefreshRate(sectorIn.refreshRate * units::s);
+                    sector->setFalseAlarms(sectorIn.falseAlarmPfa, sectorIn.rangeCellSize * units::m);
+                    sector->initializeSearchVolume();
+                    sector->initializeDwellTime(face->getHalfPowerBeamWidth(0), face->getHalfPowerBeamWidth(1));
+                    sector->randomizedStarScanPos();
+                    face->addSearchSector(*sector);
+                }
+                radarSim.addRadarFace(*face);
+            }
+
+            //target.h parameters
+            for(int i = 0; i < sim.targets.size(); i++){
+                target* radarTarget = new target;
+                initializeTargetParams(*radarTarget, sim.targets[i]);
+                radarSim.addTarget(*radarTarget);
+            }
+            compileSimulationPlan(radarSim);
+        }
+
+        //Function calls target.h setter functions to initialize a target from in-memory parameters
+        void initializeTargetParams(target &radarTarget, const targetParams &params){
+            double startPos[3] = {params.coordXYZ[0], params.coordXYZ[1], params.coordXYZ[2]};
+            radarTarget.initializePOS(startPos);
+            radarTarget.setVelocityVector(params.velocity[0], params.velocity[1], params.velocity[2]);
+            radarTarget.setAccelerationVector(params.acceleration[0], params.acceleration[1], params.acceleration[2]);
+            radarTarget.setRCS(params.rcs * units::dB);
+        }
+
+        //Function adds a trajectoryTarget to radar for every recorded track in waypoint file (if a waypoint file was inputted)
+        void initializeTrajectoryData(radar &radarSim){
+            for(size_t track = 0; track < trajectoryData.getTrackCount(); track++){
+                trajectoryTarget* recordedTarget = new trajectoryTarget(trajectoryData.getWaypoints(track), trajectoryData.getWaypointCount(track), trajectoryData.getRCS(track));
+                radarSim.addTarget(*recordedTarget);
+            }
+        }
         
-        //Function calls radar.h search detection information and outputs data to user specified .txt file
+        //Function calls radar.h search detection information and outputs data to user specified .txt file. With plot extraction,
+        //extracted plots are output in place of the search detections merged into them
         void searchDataOutput(radar &radarSim, string filename){
+            PERF_PHASE(PHASE_OUTPUT);
             ofstream searchData(filename);
 
-            vector<double> timeVector = radarSim.getSearchDetectTimeVector();
-            vector<double> SnrVector = radarSim.getSearchDetectSnrVector();
-            vector<double> azPosVector = radarSim.getSearchDetectAzPosVector();
-            vector<double> elPosVector = radarSim.getSearchDetectElPosVector();
-            vector<int> faceIterVector = radarSim.getSearchDetectFaceIterVector();
-            vector<int> sectorIterVector = radarSim.getSearchDetectSectorIterVector();
+            if(radarSim.getPlotExtraction() == true){
+                const vector<plotRecord> &plotVector = radarSim.getPlotVector();
+                for(int iter = 0; iter < plotVector.size(); iter++){
+                    searchData << "Detection(" << plotVector[iter].azPos <<"," << plotVector[iter].elPos << ") at: " << plotVector[iter].time/60 << "mins on, face " << plotVector[iter].faceIter << "-> sector " << plotVector[iter].sectorIter << endl;
+                }
+                return;
+            }
+
+            const vector<double> &timeVector = radarSim.getSearchDetectTimeVector();
+            const vector<double> &azPosVector = radarSim.getSearchDetectAzPosVector();
+            const vector<double> &elPosVector = radarSim.getSearchDetectElPosVector();
+            const vector<int> &faceIterVector = radarSim.getSearchDetectFaceIterVector();
+            const vector<int> &sectorIterVector = radarSim.getSearchDetectSectorIterVector();
             
             for(int iter = 0; iter < timeVector.size(); iter++){
                 searchData << "Detection(" << azPosVector[iter] <<"," << elPosVector[iter] << ") at: " << timeVector[iter]/60 << "mins on, face " << faceIterVector[iter] << "-> sector " << sectorIterVector[iter] << endl;
@@ -321,7 +463,33 @@ class configManager {
              
         }
 
+        //Function prints extracted plots (radar plot extraction must be enabled) to .txt file. One line per plot instead of one per target hit
+        void plotDataOutput(radar &radarSim, string filename){
+            PERF_PHASE(PHASE_OUTPUT);
+            ofstream plotData(filename);
+
+            const vector<plotRecord> &plotVector = radarSim.getPlotVector();
+            
+            for(int iter = 0; iter < plotVector.size(); iter++){
+                plotData << "Plot(" << plotVector[iter].azPos <<"," << plotVector[iter].elPos << ") at: " << plotVector[iter].time/60 << "mins on, face " << plotVector[iter].faceIter << "-> sector " << plotVector[iter].sectorIter
+                         << ", " << plotVector[iter].hitCount << " hit(s), SNR " << plotVector[iter].snr << "dB" << endl;
+            }
+             
+        }
+
        
+        //Function allocates a flat table of radar faces owned by configManager
+        radarFace* allocateFaceTable(int count){
+            faceTables.push_back(unique_ptr<radarFace[]>(new radarFace[count]));
+            return faceTables.back().get();
+        }
+
+        //Function allocates a flat table of search sectors owned by configManager
+        searchSector* allocateSectorTable(int count){
+            sectorTables.push_back(unique_ptr<searchSector[]>(new searchSector[count]));
+            return sectorTables.back().get();
+        }
+
         //Function closes all opened/inputted .txt files
         void closeInputFiles(){
             radarData.close(); 
@@ -335,6 +503,9 @@ class configManager {
     ifstream faceData;      //ifstream object handling parameters data for radarFace.h
     ifstream targetData;    //ifstream object handling parameters data for target.h
     ifstream sectorData;    //ifstream object handling parameters data for searchSector.h
+    waypointFile trajectoryData; //Memory-mapped recorded trajectories for trajectoryTarget.h
+    vector< unique_ptr<radarFace[]> > faceTables;      //Face tables of configured radars
+    vector< unique_ptr<searchSector[]> > sectorTables; //Sector tables of configured radars
     double AzElStore[2];    //temporary storage variable used for collecting inputting angle (2 inputs) data
     double xyzStore[3];     //temporary storage variable used for collecting inputting coordinate (3 inputs) data
     double* tempPointer;    //temporary pointer variable used for class functions that input pointer values (TODO: modify class functions to not use pointer inputs)
@@ -0,0 +1,78 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: counterRNG.h contains a counter-based random number generator. Each variate is a pure function of
+ *              (seed, key, counter), e.g. key = dwell number and counter = target ID, so a draw never depends on how
+ *              many draws were made before it. Results are therefore the same whatever order targets, faces or sites
+ *              are simulated in, and blocks of variates can be generated with no loop-carried state, letting the
+ *              compiler vectorize the block functions. The mixing function is two rounds of the SplitMix64 finalizer.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef COUNTERRNG_H
+#define COUNTERRNG_H
+#include <stdint.h>
+#include <math.h>
+
+using namespace std;
+
+class counterRNG {
+   public:
+      counterRNG(){
+         seed = 0x853C49E6748FEA9BULL;
+      }
+      ~counterRNG(){}
+
+      //Sets generator seed, every (key, counter) pair gives a different variate for a different seed
+      void setSeed(uint64_t newSeed){
+         seed = newSeed;
+      }
+
+      //Gets generator seed
+      uint64_t getSeed(){
+         return seed;
+      }
+
+      //Gets raw 64-bit random value for (key, counter)
+      uint64_t next64(uint64_t key, uint64_t counter){
+         return mix(mix(seed ^ (key * 0x9E3779B97F4A7C15ULL)) + (counter * 0xD1B54A32D192ED03ULL));
+      }
+
+      //Gets uniform variate in [0,1) for (key, counter)
+      double uniform(uint64_t key, uint64_t counter){
+         return (next64(key, counter) >> 11) * (1.0 / 9007199254740992.0);
+      }
+
+      //Gets standard normal variate for (key, counter), Box-Muller transform of the uniforms of counters 2*counter and 2*counter+1
+      double normal(uint64_t key, uint64_t counter){
+         double radius = sqrt(-2*log(1 - uniform(key, 2*counter)));
+         return radius * cos(2*M_PI*uniform(key, 2*counter + 1));
+      }
+
+      //Fills block with uniform variates in [0,1) for counters firstCounter...firstCounter+count-1 of one key
+      void fillUniform(uint64_t key, uint64_t firstCounter, int count, double* out){
+         uint64_t keyState = mix(seed ^ (key * 0x9E3779B97F4A7C15ULL));
+         for(int iter = 0; iter < count; iter++){
+            out[iter] = (mix(keyState + ((firstCounter + iter) * 0xD1B54A32D192ED03ULL)) >> 11) * (1.0 / 9007199254740992.0);
+         }
+      }
+
+      //Fills block with uniform variates in [0,1) for a list of counters of one key (e.g. IDs of targets in a search beam)
+      void fillUniform(uint64_t key, const uint64_t* counters, int count, double* out){
+         uint64_t keyState = mix(seed ^ (key * 0x9E3779B97F4A7C15ULL));
+         for(int iter = 0; iter < count; iter++){
+            out[iter] = (mix(keyState + (counters[iter] * 0xD1B54A32D192ED03ULL)) >> 11) * (1.0 / 9007199254740992.0);
+         }
+      }
+
+   private:
+      //SplitMix64 finalizer
+      static uint64_t mix(uint64_t value){
+         value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+         value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+         return value ^ (value >> 31);
+      }
+
+      uint64_t seed;    //Generator seed
+};
+
+#endif
@@ -0,0 +1,315 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: coverageMap.h contains coverage heatmaps accumulated during a simulation, so coverage of long runs can be
+ *              analyzed without storing every search detection. For every radar face, search beams are counted per
+ *              azimuth/elevation cell of the beam's scan position, and search detections are counted (with their summed
+ *              SNR, giving the mean SNR) per azimuth/elevation cell and optionally per range cell.
+ *              Every table is allocated once when the simulation begins and never grows while it runs. A radar fills its
+ *              own accumulator without locking (a radar runs on a single thread) and merges it into the caller's map at
+ *              the end of the simulation under the map's lock, so several radars (radar network sites running on their
+ *              own threads) can share one map, their tables summed by face number.
+ *              Maps are written as a compact binary grid (writeBinary()) or as an 8-bit PGM image of one face and layer
+ *              (writePGM(), azimuth left to right, elevation bottom to top).
+ *              Binary grid, little endian:
+ *                 header   = "RCOV", uint32 version, uint32 faces, uint32 azimuth bins, uint32 elevation bins,
+ *                            uint32 range bins, double elevation extent[2] (degrees), double maximum range (meters)
+ *                 per face = uint64 beam visits[az][el], uint64 detections[az][el][range], float mean SNR[az][el][range] (decible)
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef COVERAGEMAP_H
+#define COVERAGEMAP_H
+#include <vector>
+#include <string>
+#include <mutex>
+#include <iostream>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+using namespace std;
+
+//Layers of a coverage map written as an image
+enum coverageLayer {
+   COVERAGE_VISITS = 0,       //Search beams sent
+   COVERAGE_DETECTIONS = 1,   //Search detections (all range cells)
+   COVERAGE_MEAN_SNR = 2,     //Mean SNR of search detections (all range cells)
+   COVERAGE_HIT_RATE = 3      //Search detections per search beam
+};
+
+class coverageMap {
+   public:
+      //Inputs: azBins/elBins = azimuth (0-360 degrees) and elevation cells. rangeBins = range cells of detections.
+      //maxRange = range covered by range cells, detections beyond fall in last cell (meters). elMin/elMax = elevation extent (degrees)
+      coverageMap(int azBins = 360, int elBins = 90, int rangeBins = 1, double maxRange = 0, double elMin = 0, double elMax = 90){
+         if(azBins < 1 || elBins < 1 || rangeBins < 1 || elMax <= elMin || (rangeBins > 1 && maxRange <= 0)){
+            cout << "Error, invalid coverage map grid" << endl;
+            exit(1);
+         }
+         this->azBins = azBins;
+         this->elBins = elBins;
+         this->rangeBins = rangeBins;
+         this->maxRange = maxRange;
+         elExtent[0] = elMin;
+         elExtent[1] = elMax;
+         faceCount = 0;
+      }
+      ~coverageMap(){}
+
+      //Function sizes map to at least a given amount of radar faces. Called by radar when simulation begins
+      void reserveFaces(int faces){
+         lock_guard<mutex> lock(mergeLock);
+         resize(faces);
+      }
+
+      //Function makes map an empty accumulator with the same grid as another map
+      void configureLike(const coverageMap &other, int faces){
+         azBins = other.azBins;
+         elBins = other.elBins;
+         rangeBins = other.rangeBins;
+         maxRange = other.maxRange;
+         elExtent[0] = other.elExtent[0];
+         elExtent[1] = other.elExtent[1];
+         faceCount = 0;
+         visits.clear();
+         hits.clear();
+         snrSums.clear();
+         resize(faces);
+      }
+
+      //Function counts a search beam sent at a scan position
+      //Unit: degrees
+      void addBeam(int faceIter, double azPos, double elPos){
+         visits[faceIter*azBins*elBins + angleCell(azPos, elPos)]++;
+      }
+
+      //Function counts a search detection
+      //Inputs: azPos/elPos = scan position of search beam (degrees). range = meters. snr = decible
+      void addDetection(int faceIter, double azPos, double elPos, double range, double snr){
+         int cell = ((faceIter*azBins*elBins) + angleCell(azPos, elPos))*rangeBins + rangeCell(range);
+         hits[cell]++;
+         snrSums[cell] = snrSums[cell] + snr;
+      }
+
+      //Function adds search beam counts of a whole visit table (getVisitTable() layout)
+      void addVisitTable(const uint64_t* counts, size_t size){
+         for(size_t cellIter = 0; cellIter < size && cellIter < visits.size(); cellIter++){
+            visits[cellIter] = visits[cellIter] + counts[cellIter];
+         }
+      }
+
+      //Function adds another map (a radar's accumulator) into map. Safe to call from several threads
+      void merge(const coverageMap &other){
+         lock_guard<mutex> lock(mergeLock);
+         if(other.azBins != azBins || other.elBins != elBins || other.rangeBins != rangeBins){
+            cout << "Error, coverage maps have different grids" << endl;
+            exit(1);
+         }
+         resize(other.faceCount);
+         for(size_t cellIter = 0; cellIter < other.visits.size(); cellIter++){
+            visits[cellIter] = visits[cellIter] + other.visits[cellIter];
+         }
+         for(size_t cellIter = 0; cellIter < other.hits.size(); cellIter++){
+            hits[cellIter] = hits[cellIter] + other.hits[cellIter];
+            snrSums[cellIter] = snrSums[cellIter] + other.snrSums[cellIter];
+         }
+      }
+
+      //Function empties every table, keeping its size
+      void clear(){
+         fill(visits.begin(), visits.end(), 0);
+         fill(hits.begin(), hits.end(), 0);
+         fill(snrSums.begin(), snrSums.end(), 0);
+      }
+
+      //Gets amount of radar faces map holds
+      int getFaceCount() const { return faceCount; }
+      //Gets amount of azimuth cells
+      int getAzBins() const { return azBins; }
+      //Gets amount of elevation cells
+      int getElBins() const { return elBins; }
+      //Gets amount of range cells
+      int getRangeBins() const { return rangeBins; }
+
+      //Gets search beams sent in a cell
+      uint64_t getBeamVisits(int faceIter, int azBin, int elBin) const {
+         return visits[(faceIter*azBins + azBin)*elBins + elBin];
+      }
+
+      //Gets search detections of a cell. rangeBin = -1 for all range cells
+      uint64_t getDetections(int faceIter, int azBin, int elBin, int rangeBin = -1) const {
+         uint64_t count = 0;
+         int first = ((faceIter*azBins + azBin)*elBins + elBin)*rangeBins;
+         for(int rangeIter = 0; rangeIter < rangeBins; rangeIter++){
+            if(rangeBin < 0 || rangeBin == rangeIter){
+               count = count + hits[first + rangeIter];
+            }
+         }
+         return count;
+      }
+
+      //Gets mean SNR of a cell's search detections, 0 without detections. rangeBin = -1 for all range cells
+      //Unit: decible
+      double getMeanSNR(int faceIter, int azBin, int elBin, int rangeBin = -1) const {
+         uint64_t count = 0;
+         double sum = 0;
+         int first = ((faceIter*azBins + azBin)*elBins + elBin)*rangeBins;
+         for(int rangeIter = 0; rangeIter < rangeBins; rangeIter++){
+            if(rangeBin < 0 || rangeBin == rangeIter){
+               count = count + hits[first + rangeIter];
+               sum = sum + snrSums[first + rangeIter];
+            }
+         }
+         return (count > 0) ? sum/count : 0;
+      }
+
+      //Gets search beam counts of every face, [face][az][el]
+      const vector<uint64_t>& getVisitTable() const {
+         return visits;
+      }
+
+      //Function writes map as a binary grid (see description). Exits if file cannot be written
+      void writeBinary(string fileName) const {
+         FILE* file = fopen(fileName.c_str(), "wb");
+         if(file == NULL){
+            cout << "Error, could not open " << fileName << endl;
+            exit(1);
+         }
+         uint32_t header[5] = {1, (uint32_t)faceCount, (uint32_t)azBins, (uint32_t)elBins, (uint32_t)rangeBins};
+         fwrite("RCOV", 1, 4, file);
+         fwrite(header, sizeof(uint32_t), 5, file);
+         fwrite(elExtent, sizeof(double), 2, file);
+         fwrite(&maxRange, sizeof(double), 1, file);
+         size_t angleCells = azBins*elBins;
+         size_t cells = angleCells*rangeBins;
+         vector<float> meanSnr(cells);
+         for(int faceIter = 0; faceIter < faceCount; faceIter++){
+            fwrite(&visits[faceIter*angleCells], sizeof(uint64_t), angleCells, file);
+            fwrite(&hits[faceIter*cells], sizeof(uint64_t), cells, file);
+            for(size_t cellIter = 0; cellIter < cells; cellIter++){
+               uint64_t count = hits[faceIter*cells + cellIter];
+               meanSnr[cellIter] = (count > 0) ? snrSums[faceIter*cells + cellIter]/count : 0;
+            }
+            fwrite(meanSnr.data(), sizeof(float), cells, file);
+         }
+         fclose(file);
+      }
+
+      //Function writes one face's layer as an 8-bit PGM image, scaled from layer's smallest to largest value (empty cells black)
+      void writePGM(string fileName, int faceIter, coverageLayer layer) const {
+         if(faceIter < 0 || faceIter >= faceCount){
+            cout << "Error, coverage map has no radar face " << faceIter + 1 << endl;
+            exit(1);
+         }
+         vector<double> values(azBins*elBins);
+         vector<bool> filled(azBins*elBins);
+         double low = 0;
+         double high = 0;
+         bool first = true;
+         for(int azIter = 0; azIter < azBins; azIter++){
+            for(int elIter = 0; elIter < elBins; elIter++){
+               uint64_t beams = getBeamVisits(faceIter, azIter, elIter);
+               uint64_t detections = getDetections(faceIter, azIter, elIter);
+               double value = 0;
+               bool hasValue = false;
+               if(layer == COVERAGE_VISITS){
+                  value = beams;
+                  hasValue = beams > 0;
+               }
+               else if(layer == COVERAGE_DETECTIONS){
+                  value = detections;
+                  hasValue = detections > 0;
+               }
+               else if(layer == COVERAGE_MEAN_SNR){
+                  value = getMeanSNR(faceIter, azIter, elIter);
+                  hasValue = detections > 0;
+               }
+               else{
+                  value = (beams > 0) ? (double)detections/beams : 0;
+                  hasValue = beams > 0;
+               }
+               values[elIter*azBins + azIter] = value;
+               filled[elIter*azBins + azIter] = hasValue;
+               if(hasValue == true){
+                  low = (first == true) ? value : min(low, value);
+                  high = (first == true) ? value : max(high, value);
+                  first = false;
+               }
+            }
+         }
+         //Counts are scaled from 0, so a cell's shade is proportional to its count
+         if(layer != COVERAGE_MEAN_SNR){
+            low = 0;
+         }
+
+         FILE* file = fopen(fileName.c_str(), "wb");
+         if(file == NULL){
+            cout << "Error, could not open " << fileName << endl;
+            exit(1);
+         }
+         fprintf(file, "P5\n%d %d\n255\n", azBins, elBins);
+         vector<unsigned char> row(azBins);
+         for(int elIter = elBins - 1; elIter >= 0; elIter--){ //Highest elevation is top row
+            for(int azIter = 0; azIter < azBins; azIter++){
+               int cell = elIter*azBins + azIter;
+               if(filled[cell] == false){
+                  row[azIter] = 0;
+               }
+               else{
+                  double scale = (high > low) ? (values[cell] - low)/(high - low) : 1;
+                  row[azIter] = (unsigned char)(1 + scale*254); //Filled cells are never black
+               }
+            }
+            fwrite(row.data(), 1, azBins, file);
+         }
+         fclose(file);
+      }
+
+   private:
+      //Function grows tables to a given amount of radar faces, new faces empty
+      void resize(int faces){
+         if(faces <= faceCount){
+            return;
+         }
+         faceCount = faces;
+         visits.resize((size_t)faceCount*azBins*elBins, 0);
+         hits.resize((size_t)faceCount*azBins*elBins*rangeBins, 0);
+         snrSums.resize((size_t)faceCount*azBins*elBins*rangeBins, 0);
+      }
+
+      //Function finds azimuth/elevation cell of a scan position (elevations outside extent fall in first/last cell)
+      int angleCell(double azPos, double elPos) const {
+         double az = fmod(azPos, 360);
+         if(az < 0){
+            az = az + 360;
+         }
+         int azBin = min((int)(az/360*azBins), azBins - 1);
+         int elBin = (int)floor((elPos - elExtent[0])/(elExtent[1] - elExtent[0])*elBins);
+         elBin = max(0, min(elBin, elBins - 1));
+         return azBin*elBins + elBin;
+      }
+
+      //Function finds range cell of a range (ranges beyond maximum range fall in last cell)
+      int rangeCell(double range) const {
+         if(rangeBins == 1){
+            return 0;
+         }
+         int rangeBin = (int)(range/maxRange*rangeBins);
+         return max(0, min(rangeBin, rangeBins - 1));
+      }
+
+      int azBins;                //Azimuth cells over 360 degrees
+      int elBins;                //Elevation cells over elevation extent
+      int rangeBins;             //Range cells of detections
+      double maxRange;           //Range covered by range cells. (meters)
+      double elExtent[2];        //Elevation extent of cells. 0 = lowest. 1 = highest. (degrees)
+      int faceCount;             //Radar faces tables hold
+      vector<uint64_t> visits;   //Search beams, [face][az][el]
+      vector<uint64_t> hits;     //Search detections, [face][az][el][range]
+      vector<double> snrSums;    //Summed SNR of search detections, [face][az][el][range]. (decible)
+      mutex mergeLock;           //Serializes radars merging into map
+};
+
+#endif
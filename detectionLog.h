@@ -0,0 +1,873 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: detectionLog.h contains a compressed binary log of search detections and track events, replacing the text
+ *              dump for long runs. Records are buffered and written block by block, detections and track events in
+ *              blocks of their own. Within a detection block:
+ *                 frame/search beam times are quantized to the log's time resolution and delta coded,
+ *                 beam positions (az,el) are dictionary coded (positions are multiples of the beamwidth, so a block
+ *                 has few distinct positions; positions are stored exactly),
+ *                 SNR is quantized to the log's SNR resolution,
+ *                 face/sector/dictionary index/target ID are varints, signed deltas are zig-zag varints.
+ *              detections are grouped by face/sector, each group's deltas starting from the block's base times.
+ *              Track event blocks hold delta coded event times, event type, face and target ID, and next track beam
+ *              positions quantized to 1e-6 degrees.
+ *              A block index at the end of the file gives every block's offset and frame time span (a sparse time index),
+ *              and a group index gives every face/sector group's offset within its block and time span. A reader
+ *              (queryDetections(), queryTrackEvents(), logQuery.cpp) binary searches a face/sector's groups for a time
+ *              window and decodes only the groups inside it, so a query reads a small part of a long log.
+ *              File layout (little endian):
+ *                 header: "RSIMDLG1", version, reserved, time resolution, SNR resolution
+ *                 blocks: record count, dictionary size, payload bytes, base frame ticks, base dwell ticks,
+ *                         dictionary (az,el doubles), payload
+ *                 index:  per block offset, record count, kind (0 = detections, 1 = track events), first/last frame time
+ *                 groups: per group block, record count, face, sector (-1 for track events), payload offset/bytes,
+ *                         first/last time
+ *                 footer: group index offset, group count, index offset, block count, "RSIMDIDX"
+ *              Only version 2 logs are read, logs of any other version are rejected.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef DETECTIONLOG_H
+#define DETECTIONLOG_H
+#include "simulationRecords.h"
+#include "target.h"
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <map>
+#include <tuple>
+#include <algorithm>
+#include <string>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+using namespace std;
+
+//Search detection decoded from a detection log
+struct loggedDetection {
+   double time;         //Simulation frame time detection was made. (seconds)
+   double dwellTime;    //Time search beam making the detection was sent. (seconds)
+   double snr;          //Received SNR. (decible)
+   double azPos;        //Azimuth scanning position of search beam. (degrees)
+   double elPos;        //Elevation scanning position of search beam. (degrees)
+   int faceIter;        //Radar face that made the detection
+   int sectorIter;      //Search sector that made the detection
+   int targetID;        //ID of truth target detected, -1 if unknown
+};
+
+//Track event decoded from a detection log
+struct loggedTrackEvent {
+   double time;         //Time of event. (seconds)
+   double nextScanAz;   //Azimuth position of next track beam. (degrees)
+   double nextScanEl;   //Elevation position of next track beam. (degrees)
+   int type;            //trackEventType
+   int faceIter;        //Radar face whose search beam started the track, -1 for track beams at start of frame
+   int targetID;        //ID of truth target tracked, -1 if unknown
+};
+
+//Block kinds of a detection log
+enum detectionLogKind {
+   LOG_DETECTIONS = 0,
+   LOG_TRACK_EVENTS = 1
+};
+
+//Matches any face/sector in detection log queries
+const int LOG_ANY = -2;
+
+//Block index entry of a detection log
+struct detectionLogBlock {
+   uint64_t offset;        //File offset of block
+   uint32_t recordCount;   //Amount of records in block
+   uint32_t kind;          //detectionLogKind
+   double firstTime;       //Frame time of first record in block. (seconds)
+   double lastTime;        //Frame time of last record in block. (seconds)
+};
+
+//Group index entry of a detection log, records of one face/sector within a block
+struct detectionLogGroup {
+   uint32_t blockIter;     //Block group is in
+   uint32_t recordCount;   //Amount of records in group
+   int32_t faceIter;       //Radar face of group's records
+   int32_t sectorIter;     //Search sector of group's records, -1 for track events
+   uint32_t payloadOffset; //Offset of group's first record within block payload. (bytes)
+   uint32_t payloadBytes;  //Size of group's records. (bytes)
+   double firstTime;       //Frame time of group's first record. (seconds)
+   double lastTime;        //Frame time of group's last record. (seconds)
+};
+
+//Varint/zig-zag helpers shared by writer and reader
+class detectionLogCoding {
+   public:
+      static constexpr double TRACK_ANGLE_RESOLUTION = 1e-6;   //Resolution next track beam positions are quantized to. (degrees)
+
+      //Appends unsigned value as LEB128 varint
+      static void putVarint(vector<uint8_t> &out, uint64_t value){
+         while(value >= 0x80){
+            out.push_back((uint8_t)(value | 0x80));
+            value = value >> 7;
+         }
+         out.push_back((uint8_t)value);
+      }
+
+      //Appends signed value as zig-zag varint
+      static void putSigned(vector<uint8_t> &out, int64_t value){
+         putVarint(out, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+      }
+
+      //Reads LEB128 varint, advancing pos. Returns false past end of data
+      static bool getVarint(const uint8_t* data, size_t size, size_t &pos, uint64_t &value){
+         value = 0;
+         for(int shift = 0; shift < 64 && pos < size; shift = shift + 7){
+            uint8_t byte = data[pos];
+            pos = pos + 1;
+            value = value | ((uint64_t)(byte & 0x7F) << shift);
+            if((byte & 0x80) == 0){
+               return true;
+            }
+         }
+         return false;
+      }
+
+      //Reads zig-zag varint, advancing pos
+      static bool getSigned(const uint8_t* data, size_t size, size_t &pos, int64_t &value){
+         uint64_t raw;
+         if(getVarint(data, size, pos, raw) == false){
+            return false;
+         }
+         value = (int64_t)(raw >> 1) ^ -(int64_t)(raw & 1);
+         return true;
+      }
+};
+
+class detectionLogWriter {
+   public:
+      detectionLogWriter(){
+         timeResolution = 1e-6;   //1 microsecond time ticks by default
+         snrResolution = 1e-2;    //0.01 dB SNR steps by default
+         blockSize = 16384;
+         recordsWritten = 0;
+         currentGroup.recordCount = 0;
+      }
+      ~detectionLogWriter(){
+         close();
+      }
+
+//////////////////////////////////////////////////////////////////////////////////////
+//Setter and getter related functions (resolutions must be set before open())
+
+      //Sets resolution times are quantized to
+      //Unit: seconds
+      void setTimeResolution(double seconds){
+         timeResolution = seconds;
+      }
+
+      //Sets resolution SNR is quantized to
+      //Unit: decible
+      void setSnrResolution(double decibles){
+         snrResolution = decibles;
+      }
+
+      //Sets amount of records per block
+      void setBlockSize(int records){
+         blockSize = max(1, records);
+      }
+
+      //Gets amount of detections written
+      long getRecordsWritten(){
+         return recordsWritten;
+      }
+//////////////////////////////////////////////////////////////////////////////////////
+
+      //Function opens (truncates) log file and writes header
+      void open(string fileName){
+         close();
+         logFile.open(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+         if(logFile.is_open() == false){
+            cout << "Error, could not open detection log " << fileName << endl;
+            exit(1);
+         }
+         logFile.write("RSIMDLG1", 8);
+         uint32_t version = 2;
+         uint32_t reserved = 0;
+         writeValue(version);
+         writeValue(reserved);
+         writeValue(timeResolution);
+         writeValue(snrResolution);
+         recordsWritten = 0;
+         blockIndex.clear();
+         groupIndex.clear();
+         pending.clear();
+         pendingTracks.clear();
+      }
+
+      //Function adds a search detection to the log
+      void write(const searchDetectRecord &record){
+         loggedDetection detection;
+         detection.time = record.time;
+         detection.dwellTime = record.dwellTime;
+         detection.snr = record.snr;
+         detection.azPos = record.azPos;
+         detection.elPos = record.elPos;
+         detection.faceIter = record.faceIter;
+         detection.sectorIter = record.sectorIter;
+         detection.targetID = (record.detectedTarget != NULL) ? record.detectedTarget->getTargetID() : -1;
+         pending.push_back(detection);
+         recordsWritten = recordsWritten + 1;
+         if(pending.size() >= blockSize){
+            flushBlock();
+         }
+      }
+
+      //Function adds a track event to the log
+      void write(const trackEventRecord &record){
+         loggedTrackEvent event;
+         event.time = record.time;
+         event.nextScanAz = record.nextScanAz;
+         event.nextScanEl = record.nextScanEl;
+         event.type = record.type;
+         event.faceIter = record.faceIter;
+         event.targetID = (record.trackedTarget != NULL) ? record.trackedTarget->getTargetID() : -1;
+         pendingTracks.push_back(event);
+         recordsWritten = recordsWritten + 1;
+         if(pendingTracks.size() >= blockSize){
+            flushTrackBlock();
+         }
+      }
+
+      //Detection callback writing every search detection to the log (userData = detectionLogWriter*)
+      static void logDetection(const searchDetectRecord &record, void* userData){
+         ((detectionLogWriter*)userData)->write(record);
+      }
+
+      //Track event callback writing every track event to the log (userData = detectionLogWriter*)
+      static void logTrackEvent(const trackEventRecord &record, void* userData){
+         ((detectionLogWriter*)userData)->write(record);
+      }
+
+      //Function writes the last block, block index and footer, then closes the log
+      void close(){
+         if(logFile.is_open() == false){
+            return;
+         }
+         flushBlock();
+         flushTrackBlock();
+         uint64_t indexOffset = logFile.tellp();
+         for(int blockIter = 0; blockIter < blockIndex.size(); blockIter++){
+            writeValue(blockIndex[blockIter]);
+         }
+         uint64_t groupOffset = logFile.tellp();
+         for(int groupIter = 0; groupIter < groupIndex.size(); groupIter++){
+            writeValue(groupIndex[groupIter]);
+         }
+         uint64_t groupCount = groupIndex.size();
+         uint64_t blockCount = blockIndex.size();
+         writeValue(groupOffset);
+         writeValue(groupCount);
+         writeValue(indexOffset);
+         writeValue(blockCount);
+         logFile.write("RSIMDIDX", 8);
+         logFile.close();
+      }
+
+   private:
+      //Function encodes buffered detections as one block, grouped by face/sector (time order kept within a group)
+      void flushBlock(){
+         if(pending.empty()){
+            return;
+         }
+         uint32_t blockIter = blockIndex.size();
+         double firstTime = pending[0].time;
+         double lastTime = pending[pending.size()-1].time;
+         stable_sort(pending.begin(), pending.end(), compareGroups);
+
+         //Beam position dictionary, positions numbered in order of first use
+         map< pair<double,double>, uint32_t > dictionary;
+         vector< pair<double,double> > entries;
+         payload.clear();
+         int64_t baseFrame = quantize(firstTime, timeResolution);
+         int64_t baseDwell = quantize(pending[0].dwellTime, timeResolution);
+         int64_t lastFrame = baseFrame;
+         int64_t lastDwell = baseDwell;
+         for(int recordIter = 0; recordIter < pending.size(); recordIter++){
+            const loggedDetection &detection = pending[recordIter];
+            //New group, deltas restart from block's base times so group decodes on its own
+            if(recordIter == 0 || detection.faceIter != pending[recordIter-1].faceIter || detection.sectorIter != pending[recordIter-1].sectorIter){
+               closeGroup();
+               openGroup(blockIter, detection.faceIter, detection.sectorIter, detection.time);
+               lastFrame = baseFrame;
+               lastDwell = baseDwell;
+            }
+            currentGroup.recordCount = currentGroup.recordCount + 1;
+            currentGroup.lastTime = detection.time;
+            int64_t frame = quantize(detection.time, timeResolution);
+            int64_t dwell = quantize(detection.dwellTime, timeResolution);
+            detectionLogCoding::putSigned(payload, frame - lastFrame);
+            detectionLogCoding::putSigned(payload, dwell - lastDwell);
+            lastFrame = frame;
+            lastDwell = dwell;
+
+            pair<double,double> position(detection.azPos, detection.elPos);
+            map< pair<double,double>, uint32_t >::iterator found = dictionary.find(position);
+            uint32_t positionIter;
+            if(found == dictionary.end()){
+               positionIter = entries.size();
+               dictionary[position] = positionIter;
+               entries.push_back(position);
+            }
+            else{
+               positionIter = found->second;
+            }
+            detectionLogCoding::putVarint(payload, detection.faceIter);
+            detectionLogCoding::putVarint(payload, detection.sectorIter);
+            detectionLogCoding::putVarint(payload, positionIter);
+            detectionLogCoding::putSigned(payload, quantize(detection.snr, snrResolution));
+            detectionLogCoding::putVarint(payload, (uint64_t)(detection.targetID + 1)); //0 = unknown target
+         }
+         closeGroup();
+
+         detectionLogBlock block;
+         block.offset = logFile.tellp();
+         block.recordCount = pending.size();
+         block.kind = LOG_DETECTIONS;
+         block.firstTime = firstTime;
+         block.lastTime = lastTime;
+         blockIndex.push_back(block);
+
+         uint32_t recordCount = pending.size();
+         uint32_t dictionarySize = entries.size();
+         uint32_t payloadBytes = payload.size();
+         writeValue(recordCount);
+         writeValue(dictionarySize);
+         writeValue(payloadBytes);
+         writeValue(baseFrame);
+         writeValue(baseDwell);
+         for(int entryIter = 0; entryIter < entries.size(); entryIter++){
+            writeValue(entries[entryIter].first);
+            writeValue(entries[entryIter].second);
+         }
+         logFile.write((const char*)payload.data(), payload.size());
+         pending.clear();
+      }
+
+      //Function encodes buffered track events as one block, grouped by face (time order kept within a group)
+      void flushTrackBlock(){
+         if(pendingTracks.empty()){
+            return;
+         }
+         uint32_t blockIter = blockIndex.size();
+         double firstTime = pendingTracks[0].time;
+         double lastTime = pendingTracks[pendingTracks.size()-1].time;
+         stable_sort(pendingTracks.begin(), pendingTracks.end(), compareTrackGroups);
+
+         payload.clear();
+         int64_t baseTime = quantize(firstTime, timeResolution);
+         int64_t lastTick = baseTime;
+         for(int recordIter = 0; recordIter < pendingTracks.size(); recordIter++){
+            const loggedTrackEvent &event = pendingTracks[recordIter];
+            if(recordIter == 0 || event.faceIter != pendingTracks[recordIter-1].faceIter){
+               closeGroup();
+               openGroup(blockIter, event.faceIter, -1, event.time);
+               lastTick = baseTime;
+            }
+            currentGroup.recordCount = currentGroup.recordCount + 1;
+            currentGroup.lastTime = event.time;
+            int64_t tick = quantize(event.time, timeResolution);
+            detectionLogCoding::putSigned(payload, tick - lastTick);
+            lastTick = tick;
+            detectionLogCoding::putVarint(payload, event.type);
+            detectionLogCoding::putVarint(payload, (uint64_t)(event.faceIter + 1)); //0 = track beams at start of frame
+            detectionLogCoding::putVarint(payload, (uint64_t)(event.targetID + 1)); //0 = unknown target
+            detectionLogCoding::putSigned(payload, quantize(event.nextScanAz, detectionLogCoding::TRACK_ANGLE_RESOLUTION));
+            detectionLogCoding::putSigned(payload, quantize(event.nextScanEl, detectionLogCoding::TRACK_ANGLE_RESOLUTION));
+         }
+         closeGroup();
+
+         detectionLogBlock block;
+         block.offset = logFile.tellp();
+         block.recordCount = pendingTracks.size();
+         block.kind = LOG_TRACK_EVENTS;
+         block.firstTime = firstTime;
+         block.lastTime = lastTime;
+         blockIndex.push_back(block);
+
+         uint32_t recordCount = pendingTracks.size();
+         uint32_t dictionarySize = 0;
+         uint32_t payloadBytes = payload.size();
+         int64_t baseDwell = 0;
+         writeValue(recordCount);
+         writeValue(dictionarySize);
+         writeValue(payloadBytes);
+         writeValue(baseTime);
+         writeValue(baseDwell);
+         logFile.write((const char*)payload.data(), payload.size());
+         pendingTracks.clear();
+      }
+
+      //Function starts group of block being encoded
+      void openGroup(uint32_t blockIter, int faceIter, int sectorIter, double time){
+         currentGroup.blockIter = blockIter;
+         currentGroup.recordCount = 0;
+         currentGroup.faceIter = faceIter;
+         currentGroup.sectorIter = sectorIter;
+         currentGroup.payloadOffset = payload.size();
+         currentGroup.payloadBytes = 0;
+         currentGroup.firstTime = time;
+         currentGroup.lastTime = time;
+      }
+
+      //Function ends group being encoded, adding it to group index
+      void closeGroup(){
+         if(currentGroup.recordCount == 0){
+            return;
+         }
+         currentGroup.payloadBytes = payload.size() - currentGroup.payloadOffset;
+         groupIndex.push_back(currentGroup);
+         currentGroup.recordCount = 0;
+      }
+
+      //Order of detections within a block: face, then sector
+      static bool compareGroups(const loggedDetection &first, const loggedDetection &second){
+         if(first.faceIter != second.faceIter){
+            return first.faceIter < second.faceIter;
+         }
+         return first.sectorIter < second.sectorIter;
+      }
+
+      //Order of track events within a block: face
+      static bool compareTrackGroups(const loggedTrackEvent &first, const loggedTrackEvent &second){
+         return first.faceIter < second.faceIter;
+      }
+
+      //Function quantizes a value to a resolution
+      static int64_t quantize(double value, double resolution){
+         return (int64_t)llround(value / resolution);
+      }
+
+      //Function writes raw value to log
+      template <class valueType>
+      void writeValue(const valueType &value){
+         logFile.write((const char*)&value, sizeof(value));
+      }
+
+      ofstream logFile;                      //Detection log being written
+      double timeResolution;                 //Resolution times are quantized to. (seconds)
+      double snrResolution;                  //Resolution SNR is quantized to. (decible)
+      int blockSize;                         //Amount of detections per block
+      long recordsWritten;                   //Amount of detections written
+      vector<loggedDetection> pending;       //Detections of block being built
+      vector<loggedTrackEvent> pendingTracks; //Track events of block being built
+      vector<uint8_t> payload;               //Encoded records of block being built
+      vector<detectionLogBlock> blockIndex;  //Index of written blocks
+      vector<detectionLogGroup> groupIndex;  //Index of written face/sector groups
+      detectionLogGroup currentGroup;        //Group being encoded
+};
+
+class detectionLogReader {
+   public:
+      detectionLogReader(){
+         timeResolution = 0;
+         snrResolution = 0;
+         version = 0;
+         bytesRead = 0;
+         cachedBlock = -1;
+      }
+      ~detectionLogReader(){}
+
+      //Function opens a detection log and reads its block and group indexes. Returns false if file is not a complete detection log
+      bool open(string fileName){
+         blockIndex.clear();
+         groupIndex.clear();
+         groupsByKey.clear();
+         blockFirstGroup.clear();
+         cachedBlock = -1;
+         bytesRead = 0;
+         logFile.close();
+         logFile.clear();
+         logFile.open(fileName.c_str(), ios::in | ios::binary);
+         if(logFile.is_open() == false){
+            return false;
+         }
+         char magic[8];
+         uint32_t reserved;
+         logFile.read(magic, 8);
+         readValue(version);
+         readValue(reserved);
+         readValue(timeResolution);
+         readValue(snrResolution);
+         if(!logFile || memcmp(magic, "RSIMDLG1", 8) != 0 || version != 2){
+            return false;
+         }
+
+         //Footer, then block index and group index
+         uint64_t indexOffset;
+         uint64_t blockCount;
+         logFile.seekg(-24, ios::end);
+         readValue(indexOffset);
+         readValue(blockCount);
+         logFile.read(magic, 8);
+         if(!logFile || memcmp(magic, "RSIMDIDX", 8) != 0){
+            return false;
+         }
+         logFile.seekg(indexOffset);
+         blockIndex.resize(blockCount);
+         for(uint64_t blockIter = 0; blockIter < blockCount; blockIter++){
+            readValue(blockIndex[blockIter]);
+         }
+         uint64_t groupOffset;
+         uint64_t groupCount;
+         logFile.seekg(-40, ios::end);
+         readValue(groupOffset);
+         readValue(groupCount);
+         logFile.seekg(groupOffset);
+         groupIndex.resize(groupCount);
+         blockFirstGroup.assign(blockCount + 1, groupCount);
+         for(uint64_t groupIter = 0; groupIter < groupCount; groupIter++){
+            readValue(groupIndex[groupIter]);
+            const detectionLogGroup &group = groupIndex[groupIter];
+            if(group.blockIter >= blockCount || (groupIter > 0 && group.blockIter < groupIndex[groupIter - 1].blockIter)){
+               return false; //Groups are written in block order
+            }
+            if(blockFirstGroup[group.blockIter] == groupCount){
+               blockFirstGroup[group.blockIter] = groupIter;
+            }
+            groupsByKey[groupKey(blockIndex[group.blockIter].kind, group.faceIter, group.sectorIter)].push_back(groupIter);
+         }
+         for(int64_t blockIter = (int64_t)blockCount - 1; blockIter >= 0; blockIter--){
+            blockFirstGroup[blockIter] = min(blockFirstGroup[blockIter], blockFirstGroup[blockIter + 1]); //Blocks with no groups
+         }
+         return (bool)logFile;
+      }
+
+      //Gets amount of blocks in log
+      int getBlockCount(){
+         return blockIndex.size();
+      }
+
+      //Gets index entry of a block
+      detectionLogBlock getBlock(int blockIter){
+         return blockIndex[blockIter];
+      }
+
+      //Gets amount of search detections in log
+      long getRecordCount(){
+         long count = 0;
+         for(int blockIter = 0; blockIter < blockIndex.size(); blockIter++){
+            if(blockIndex[blockIter].kind == LOG_DETECTIONS){
+               count = count + blockIndex[blockIter].recordCount;
+            }
+         }
+         return count;
+      }
+
+      //Gets amount of track events in log
+      long getTrackEventCount(){
+         long count = 0;
+         for(int blockIter = 0; blockIter < blockIndex.size(); blockIter++){
+            if(blockIndex[blockIter].kind == LOG_TRACK_EVENTS){
+               count = count + blockIndex[blockIter].recordCount;
+            }
+         }
+         return count;
+      }
+
+      //Function finds first block that can contain detections made at or after a frame time (binary search of block index).
+      //Blocks of track events are skipped by readBlock(), as they do not follow detection blocks' time order
+      //Unit: seconds
+      int findBlock(double time){
+         int low = 0;
+         int high = blockIndex.size();
+         while(low < high){
+            int middle = (low + high) / 2;
+            if(blockIndex[middle].lastTime < time && blockIndex[middle].kind == LOG_DETECTIONS){
+               low = middle + 1;
+            }
+            else{
+               high = middle;
+            }
+         }
+         return low;
+      }
+
+      //Function decodes one block of detections, in the order they were written. Track event blocks give no detections.
+      //Returns false if block is malformed
+      bool readBlock(int blockIter, vector<loggedDetection> &detections){
+         detections.clear();
+         if(blockIndex[blockIter].kind != LOG_DETECTIONS){
+            return true;
+         }
+         if(loadBlockHeader(blockIter) == false){
+            return false;
+         }
+         for(uint64_t groupIter = blockFirstGroup[blockIter]; groupIter < blockFirstGroup[blockIter + 1]; groupIter++){
+            const detectionLogGroup &group = groupIndex[groupIter];
+            if(decodeDetections(group.payloadOffset, group.payloadBytes, group.recordCount, detections) == false){
+               return false;
+            }
+         }
+         stable_sort(detections.begin(), detections.end(), compareWritten); //Back from face/sector groups to written order
+         return true;
+      }
+
+      //Function finds detections within a frame time window, on a face and sector (LOG_ANY = every face/sector).
+      //Only groups of the face/sector overlapping the window are decoded. Returns false if log is malformed
+      //Unit: seconds
+      bool queryDetections(double startTime, double endTime, int faceIter, int sectorIter, vector<loggedDetection> &detections){
+         detections.clear();
+         vector<loggedDetection> decoded;
+         for(map< tuple<int,int,int>, vector<int> >::iterator keyIter = groupsByKey.begin(); keyIter != groupsByKey.end(); keyIter++){
+            if(get<0>(keyIter->first) != LOG_DETECTIONS || (faceIter != LOG_ANY && get<1>(keyIter->first) != faceIter)
+               || (sectorIter != LOG_ANY && get<2>(keyIter->first) != sectorIter)){
+               continue;
+            }
+            const vector<int> &groups = keyIter->second;
+            for(int position = firstGroup(groups, startTime); position < groups.size(); position++){
+               const detectionLogGroup &group = groupIndex[groups[position]];
+               if(group.firstTime > endTime){
+                  break;
+               }
+               decoded.clear();
+               if(loadBlockHeader(group.blockIter) == false || decodeDetections(group.payloadOffset, group.payloadBytes, group.recordCount, decoded) == false){
+                  return false;
+               }
+               appendMatches(decoded, startTime, endTime, LOG_ANY, LOG_ANY, detections);
+            }
+         }
+         stable_sort(detections.begin(), detections.end(), compareWritten);
+         return true;
+      }
+
+      //Function finds track events within a time window, of a face (-1 = track beams at start of frame, LOG_ANY = every event).
+      //Only groups of the face overlapping the window are decoded. Returns false if log is malformed
+      //Unit: seconds
+      bool queryTrackEvents(double startTime, double endTime, int faceIter, vector<loggedTrackEvent> &events){
+         events.clear();
+         vector<loggedTrackEvent> decoded;
+         for(map< tuple<int,int,int>, vector<int> >::iterator keyIter = groupsByKey.begin(); keyIter != groupsByKey.end(); keyIter++){
+            if(get<0>(keyIter->first) != LOG_TRACK_EVENTS || (faceIter != LOG_ANY && get<1>(keyIter->first) != faceIter)){
+               continue;
+            }
+            const vector<int> &groups = keyIter->second;
+            for(int position = firstGroup(groups, startTime); position < groups.size(); position++){
+               const detectionLogGroup &group = groupIndex[groups[position]];
+               if(group.firstTime > endTime){
+                  break;
+               }
+               decoded.clear();
+               if(loadBlockHeader(group.blockIter) == false || decodeTrackEvents(group.payloadOffset, group.payloadBytes, group.recordCount, decoded) == false){
+                  return false;
+               }
+               for(int eventIter = 0; eventIter < decoded.size(); eventIter++){
+                  if(decoded[eventIter].time >= startTime && decoded[eventIter].time <= endTime){
+                     events.push_back(decoded[eventIter]);
+                  }
+               }
+            }
+         }
+         stable_sort(events.begin(), events.end(), compareEventTimes);
+         return true;
+      }
+
+      //Gets resolution times were quantized to
+      //Unit: seconds
+      double getTimeResolution(){
+         return timeResolution;
+      }
+
+      //Gets resolution SNR was quantized to
+      //Unit: decible
+      double getSnrResolution(){
+         return snrResolution;
+      }
+
+      //Gets amount of block bytes read since log was opened (indexes excluded)
+      //Unit: bytes
+      uint64_t getBytesRead(){
+         return bytesRead;
+      }
+
+   private:
+      //Key of a face/sector's groups
+      static tuple<int,int,int> groupKey(int kind, int faceIter, int sectorIter){
+         return make_tuple(kind, faceIter, sectorIter);
+      }
+
+      //Function finds first group of a face/sector's groups (in block order) that can contain records at or after a time
+      int firstGroup(const vector<int> &groups, double time){
+         int low = 0;
+         int high = groups.size();
+         while(low < high){
+            int middle = (low + high) / 2;
+            if(groupIndex[groups[middle]].lastTime < time){
+               low = middle + 1;
+            }
+            else{
+               high = middle;
+            }
+         }
+         return low;
+      }
+
+      //Function reads a block's header and dictionary, kept until another block is read
+      bool loadBlockHeader(int blockIter){
+         if(cachedBlock == blockIter){
+            return true;
+         }
+         cachedBlock = -1;
+         logFile.clear();
+         logFile.seekg(blockIndex[blockIter].offset);
+         uint32_t recordCount;
+         uint32_t dictionarySize;
+         readValue(recordCount);
+         readValue(dictionarySize);
+         readValue(cachedPayloadBytes);
+         readValue(cachedFrame);
+         readValue(cachedDwell);
+         cachedEntries.resize(dictionarySize);
+         for(int entryIter = 0; entryIter < dictionarySize; entryIter++){
+            readValue(cachedEntries[entryIter].first);
+            readValue(cachedEntries[entryIter].second);
+         }
+         if(!logFile){
+            return false;
+         }
+         cachedPayloadOffset = logFile.tellg();
+         bytesRead = bytesRead + (cachedPayloadOffset - blockIndex[blockIter].offset);
+         cachedBlock = blockIter;
+         return true;
+      }
+
+      //Function reads part of cached block's payload
+      bool readPayload(uint32_t offset, uint32_t bytes){
+         if((uint64_t)offset + bytes > cachedPayloadBytes){
+            return false;
+         }
+         payload.resize(bytes);
+         logFile.clear();
+         logFile.seekg(cachedPayloadOffset + offset);
+         logFile.read((char*)payload.data(), bytes);
+         bytesRead = bytesRead + bytes;
+         return (bool)logFile;
+      }
+
+      //Function decodes detections of cached block's payload, deltas starting from block's base times
+      bool decodeDetections(uint32_t offset, uint32_t bytes, uint32_t recordCount, vector<loggedDetection> &detections){
+         if(readPayload(offset, bytes) == false){
+            return false;
+         }
+         int64_t frame = cachedFrame;
+         int64_t dwell = cachedDwell;
+         size_t pos = 0;
+         for(uint32_t recordIter = 0; recordIter < recordCount; recordIter++){
+            int64_t frameDelta, dwellDelta, snr;
+            uint64_t face, sector, positionIter, targetID;
+            bool valid = detectionLogCoding::getSigned(payload.data(), bytes, pos, frameDelta)
+                      && detectionLogCoding::getSigned(payload.data(), bytes, pos, dwellDelta)
+                      && detectionLogCoding::getVarint(payload.data(), bytes, pos, face)
+                      && detectionLogCoding::getVarint(payload.data(), bytes, pos, sector)
+                      && detectionLogCoding::getVarint(payload.data(), bytes, pos, positionIter)
+                      && detectionLogCoding::getSigned(payload.data(), bytes, pos, snr)
+                      && detectionLogCoding::getVarint(payload.data(), bytes, pos, targetID);
+            if(valid == false || positionIter >= cachedEntries.size()){
+               return false;
+            }
+            frame = frame + frameDelta;
+            dwell = dwell + dwellDelta;
+            loggedDetection detection;
+            detection.time = frame * timeResolution;
+            detection.dwellTime = dwell * timeResolution;
+            detection.snr = snr * snrResolution;
+            detection.azPos = cachedEntries[positionIter].first;
+            detection.elPos = cachedEntries[positionIter].second;
+            detection.faceIter = face;
+            detection.sectorIter = sector;
+            detection.targetID = (int)targetID - 1;
+            detections.push_back(detection);
+         }
+         return true;
+      }
+
+      //Function decodes track events of cached block's payload, deltas starting from block's base time
+      bool decodeTrackEvents(uint32_t offset, uint32_t bytes, uint32_t recordCount, vector<loggedTrackEvent> &events){
+         if(readPayload(offset, bytes) == false){
+            return false;
+         }
+         int64_t tick = cachedFrame;
+         size_t pos = 0;
+         for(uint32_t recordIter = 0; recordIter < recordCount; recordIter++){
+            int64_t tickDelta, az, el;
+            uint64_t type, face, targetID;
+            bool valid = detectionLogCoding::getSigned(payload.data(), bytes, pos, tickDelta)
+                      && detectionLogCoding::getVarint(payload.data(), bytes, pos, type)
+                      && detectionLogCoding::getVarint(payload.data(), bytes, pos, face)
+                      && detectionLogCoding::getVarint(payload.data(), bytes, pos, targetID)
+                      && detectionLogCoding::getSigned(payload.data(), bytes, pos, az)
+                      && detectionLogCoding::getSigned(payload.data(), bytes, pos, el);
+            if(valid == false){
+               return false;
+            }
+            tick = tick + tickDelta;
+            loggedTrackEvent event;
+            event.time = tick * timeResolution;
+            event.type = type;
+            event.faceIter = (int)face - 1;
+            event.targetID = (int)targetID - 1;
+            event.nextScanAz = az * detectionLogCoding::TRACK_ANGLE_RESOLUTION;
+            event.nextScanEl = el * detectionLogCoding::TRACK_ANGLE_RESOLUTION;
+            events.push_back(event);
+         }
+         return true;
+      }
+
+      //Function adds detections within a time window and face/sector to results
+      static void appendMatches(const vector<loggedDetection> &decoded, double startTime, double endTime, int faceIter, int sectorIter, vector<loggedDetection> &detections){
+         for(int recordIter = 0; recordIter < decoded.size(); recordIter++){
+            const loggedDetection &detection = decoded[recordIter];
+            if(detection.time >= startTime && detection.time <= endTime && (faceIter == LOG_ANY || detection.faceIter == faceIter)
+               && (sectorIter == LOG_ANY || detection.sectorIter == sectorIter)){
+               detections.push_back(detection);
+            }
+         }
+      }
+
+      //Written order of detections: frame, face, search beam time (detections of one search beam keep their order)
+      static bool compareWritten(const loggedDetection &first, const loggedDetection &second){
+         if(first.time != second.time){
+            return first.time < second.time;
+         }
+         if(first.faceIter != second.faceIter){
+            return first.faceIter < second.faceIter;
+         }
+         return first.dwellTime < second.dwellTime;
+      }
+
+      //Order of track events: time (events of one time keep their order)
+      static bool compareEventTimes(const loggedTrackEvent &first, const loggedTrackEvent &second){
+         return first.time < second.time;
+      }
+
+      //Function reads raw value from log
+      template <class valueType>
+      void readValue(valueType &value){
+         logFile.read((char*)&value, sizeof(value));
+      }
+
+      ifstream logFile;                      //Detection log being read
+      uint32_t version;                      //Log format version
+      double timeResolution;                 //Resolution times were quantized to. (seconds)
+      double snrResolution;                  //Resolution SNR was quantized to. (decible)
+      vector<detectionLogBlock> blockIndex;  //Index of every block
+      vector<detectionLogGroup> groupIndex;  //Index of every face/sector group, in block order
+      vector<uint64_t> blockFirstGroup;      //First group of every block within group index (last entry = group count)
+      map< tuple<int,int,int>, vector<int> > groupsByKey; //Groups of every block kind/face/sector, in block order
+      uint64_t bytesRead;                    //Block bytes read
+      int cachedBlock;                       //Block whose header/dictionary is cached, -1 = none
+      uint32_t cachedPayloadBytes;           //Payload size of cached block. (bytes)
+      uint64_t cachedPayloadOffset;          //File offset of cached block's payload
+      int64_t cachedFrame;                   //Base frame/time ticks of cached block
+      int64_t cachedDwell;                   //Base search beam time ticks of cached block
+      vector< pair<double,double> > cachedEntries; //Beam position dictionary of cached block
+      vector<uint8_t> payload;               //Encoded records being read
+};
+
+#endif
@@ -0,0 +1,135 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: detectionModel.h contains the probability-of-detection model used for search and track beams. By default
+ *              detection is a hard threshold (received SNR >= minimum SNR). When a Swerling case is selected, the
+ *              probability of detection (Pd) is computed from the received SNR and the configured probability of
+ *              false alarm (Pfa), and a detection is made when a uniform random draw falls below Pd.
+ *              Every search/track beam is simulated as a single look at the integrated SNR, so for one look the
+ *              pulse-to-pulse cases reduce to their scan-to-scan counterparts (Swerling 2 = 1, Swerling 4 = 3).
+ *                 Swerling 0 (non-fluctuating): North's approximation, Pd = 0.5*erfc(sqrt(-ln Pfa) - sqrt(SNR + 0.5))
+ *                 Swerling 1/2 (chi-square, 2 DOF): Pd = Pfa^(1/(1+SNR))
+ *                 Swerling 3/4 (chi-square, 4 DOF): Pd = (1 + 2*SNR*(-ln Pfa)/(2+SNR)^2) * exp(-2*(-ln Pfa)/(2+SNR))
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef DETECTIONMODEL_H
+#define DETECTIONMODEL_H
+#include "utility.h"
+#include <iostream>
+#include <math.h>
+
+using namespace std;
+
+//Detection models
+enum swerlingCase {
+   SNR_THRESHOLD = -1,  //Hard SNR threshold (no fluctuation, no false alarm probability)
+   SWERLING_0 = 0,
+   SWERLING_1 = 1,
+   SWERLING_2 = 2,
+   SWERLING_3 = 3,
+   SWERLING_4 = 4
+};
+
+class detectionModel {
+   public:
+      detectionModel(){
+         model = SNR_THRESHOLD;  //Hard threshold by default
+         pfa = 1e-6;
+         cullingPd = 1e-4;
+      }
+      ~detectionModel(){}
+
+//////////////////////////////////////////////////////////////////////////////////////
+//Setter and getter related functions
+
+      //Sets detection model and probability of false alarm
+      //Input: swerling = Swerling case or SNR_THRESHOLD. falseAlarm = Pfa (0 < Pfa < 1)
+      void setModel(swerlingCase swerling, double falseAlarm){
+         if(falseAlarm <= 0 || falseAlarm >= 1){
+            cout << "Error, probability of false alarm must be between 0 and 1" << endl;
+            exit(1);
+         }
+         model = swerling;
+         pfa = falseAlarm;
+      }
+
+      //Gets detection model
+      swerlingCase getModel(){
+         return model;
+      }
+
+      //Gets bool determining if detections are probabilistic (Swerling case selected)
+      bool isProbabilistic(){
+         return model != SNR_THRESHOLD;
+      }
+
+      //Gets probability of false alarm
+      double getPfa(){
+         return pfa;
+      }
+
+      //Sets probability of detection below which a target is treated as undetectable by range culling
+      void setCullingPd(double pd){
+         cullingPd = pd;
+      }
+//////////////////////////////////////////////////////////////////////////////////////
+
+      //Function calculates probability of detection for a received SNR
+      //Unit: decible
+      double probabilityOfDetection(double snrdB){
+         double snr = utility::dBtoWatts(snrdB);   //dB to linear power ratio
+         double threshold = -log(pfa);             //Normalized detection threshold
+         switch(model){
+            case SWERLING_0:
+               return 0.5*erfc(sqrt(threshold) - sqrt(snr + 0.5));
+            case SWERLING_1:
+            case SWERLING_2:
+               return exp(-threshold/(1 + snr));
+            case SWERLING_3:
+            case SWERLING_4:
+               return (1 + (2*snr*threshold)/pow(2 + snr, 2)) * exp((-2*threshold)/(2 + snr));
+            default:
+               return 1;
+         }
+      }
+
+      //Function determines detection from received SNR. Hard threshold compares to snrMin, Swerling cases compare a uniform draw to Pd
+      //Inputs: snrdB = received SNR (decible). snrMin = minimum detectable SNR (decible). uniformDraw = uniform random variate in [0,1)
+      bool isDetected(double snrdB, double snrMin, double uniformDraw){
+         if(model == SNR_THRESHOLD){
+            return snrdB >= snrMin;
+         }
+         return uniformDraw < probabilityOfDetection(snrdB);
+      }
+
+      //Function gives SNR below which a target is treated as undetectable (used for range culling). For the hard threshold this is
+      //snrMin, for Swerling cases it is the SNR where Pd falls to the culling Pd (solved by bisection)
+      //Unit: decible
+      double getCullingSNR(double snrMin){
+         if(model == SNR_THRESHOLD){
+            return snrMin;
+         }
+         if(cullingPd <= pfa){
+            return -1000; //Pd never falls below Pfa, nothing can be culled by range
+         }
+         double low = -100;
+         double high = 100;
+         for(int iter = 0; iter < 60; iter++){
+            double middle = 0.5*(low + high);
+            if(probabilityOfDetection(middle) < cullingPd){
+               low = middle;
+            }
+            else{
+               high = middle;
+            }
+         }
+         return low;
+      }
+
+   private:
+      swerlingCase model;  //Detection model
+      double pfa;          //Probability of false alarm. (unitless)
+      double cullingPd;    //Probability of detection below which a target is treated as undetectable. (unitless)
+};
+
+#endif
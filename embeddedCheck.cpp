@@ -0,0 +1,208 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: embeddedCheck.cpp checks the step-wise simulation interface (radarSimulation.h). A scenario with no
+ *              targets is advanced with runUntil() to times between frame boundaries, a target is injected mid-run and
+ *              later removed. The same run is repeated stepping the radar one frame at a time, giving every frame boundary
+ *              (track beams push a frame past its refresh rate). The check verifies that:
+ *                 runUntil(t) ends on the first frame boundary at or after t
+ *                 the injected target is detected only after its injection time
+ *                 the removed target is never detected or tracked after its removal
+ *                 g++ -O2 -std=c++17 -pthread embeddedCheck.cpp -o embeddedCheck
+ *                 ./embeddedCheck
+ *              Returns 0 if every check passes, 1 otherwise.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "radarSimulation.h"
+#include <stdio.h>
+
+using namespace std;
+
+//Record of a run kept by the callbacks
+struct embeddedRecord {
+   char kind;        //'D' = search detection. 'T' = track event
+   int targetID;     //Truth target, -1 for false alarm
+   double time;      //Search beam time, or track event time. (seconds)
+};
+
+//Stores search detections of the run
+void storeDetection(const searchDetectRecord &record, void* userData){
+   embeddedRecord entry;
+   entry.kind = 'D';
+   entry.targetID = (record.detectedTarget != NULL) ? record.detectedTarget->getTargetID() : -1;
+   entry.time = record.dwellTime;
+   ((vector<embeddedRecord>*)userData)->push_back(entry);
+}
+
+//Stores track events of the run
+void storeTrackEvent(const trackEventRecord &record, void* userData){
+   embeddedRecord entry;
+   entry.kind = 'T';
+   entry.targetID = record.trackedTarget->getTargetID();
+   entry.time = record.time;
+   ((vector<embeddedRecord>*)userData)->push_back(entry);
+}
+
+//Four faces covering the site, one search sector each, no scenario targets
+scenario buildScenario(double refreshRate){
+   scenario sim;
+   sim.trackPRF = 2;
+   sim.trackingSNRmin = 0;
+   sim.trackBeamWidth[0] = 10;   //Wider than search beam, so every search detection is confirmed
+   sim.trackBeamWidth[1] = 10;
+   sim.filterWeights[0] = .3;
+   sim.filterWeights[1] = .4;
+   sim.filterWeights[2] = 1;
+   sim.refreshRate = refreshRate;
+   sim.simLength = 10;
+   for(int faceIter = 0; faceIter < 4; faceIter++){
+      faceParams face;
+      double azBegin = faceIter*90.0;
+      face.boresight[0] = azBegin + 45;
+      face.boresight[1] = 45;
+      face.azExtent[0] = azBegin;
+      face.azExtent[1] = azBegin + 90;
+      face.elExtent[0] = 0;
+      face.elExtent[1] = 90;
+      face.halfPowerBeamWidth[0] = 5;
+      face.halfPowerBeamWidth[1] = 5;
+      face.SNRmin = 0;
+      face.waveFreq = 90;
+      face.bandwidth = 30;
+      face.effectiveAttenaArea = 5;
+      face.peakPower = 150;
+      face.noiseFigure = 2.5;
+      face.totalSysLoss = 9;
+      sectorParams sector;
+      sector.azExtent[0] = azBegin;
+      sector.azExtent[1] = azBegin + 90;
+      sector.elExtent[0] = 0;
+      sector.elExtent[1] = 90;
+      sector.rangeExtent[0] = 0;
+      sector.rangeExtent[1] = 200;
+      sector.refreshRate = refreshRate;
+      face.sectors.push_back(sector);
+      sim.faces.push_back(face);
+   }
+   return sim;
+}
+
+//Advances simulation to endTime. The reference run steps the radar one frame at a time and stores every frame boundary, the
+//checked run calls runUntil(). Returns time simulation stopped at
+double advance(radarSimulation &sim, double endTime, bool reference, vector<double> &boundaries){
+   if(reference == false){
+      sim.runUntil(endTime);
+      return sim.getTime();
+   }
+   while(sim.getTime() < endTime){
+      sim.getRadar().stepFrame();
+      boundaries.push_back(sim.getTime());
+   }
+   return sim.getTime();
+}
+
+//Runs scenario, injecting a target mid-run and removing it later. Every stop time of the run is stored in stops
+void runScenario(bool reference, vector<embeddedRecord> &records, vector<double> &stops, vector<double> &boundaries,
+                 double &injectTime, double &removeTime, int &targetID){
+   srand(1);   //Fixed starting scan positions, same in both runs
+   radarSimulation sim(buildScenario(1));
+   sim.setDetectionCallback(storeDetection, &records);
+   sim.setTrackEventCallback(storeTrackEvent, &records);
+
+   //Requested times fall between frame boundaries and on them
+   stops.push_back(advance(sim, 10.4, reference, boundaries));
+   stops.push_back(advance(sim, 11, reference, boundaries));
+
+   //Slow target 60 km from the site, well inside search coverage
+   targetParams params;
+   params.coordXYZ[0] = 40;
+   params.coordXYZ[1] = 45;
+   params.coordXYZ[2] = 2.6;
+   params.velocity[0] = 100;
+   params.velocity[1] = 0;
+   params.velocity[2] = 0;
+   for(int i = 0; i < 3; i++){
+      params.acceleration[i] = 0;
+   }
+   params.rcs = 10;
+   injectTime = sim.getTime();
+   target* injected = sim.injectTarget(params);
+   targetID = injected->getTargetID();
+
+   stops.push_back(advance(sim, injectTime + 20.5, reference, boundaries));
+   removeTime = sim.getTime();
+   sim.removeTarget(injected);
+   stops.push_back(advance(sim, 45.2, reference, boundaries));
+   sim.finish();
+}
+
+int main(){
+   const double requested[4] = {10.4, 11, 0, 45.2};   //Times runs are advanced to, third is set from injection time
+   bool passed = true;
+   vector<embeddedRecord> referenceRecords;
+   vector<double> referenceStops;
+   vector<double> boundaries;
+   vector<embeddedRecord> records;
+   vector<double> stops;
+   vector<double> unused;
+   double injectTime;
+   double removeTime;
+   int targetID;
+   runScenario(true, referenceRecords, referenceStops, boundaries, injectTime, removeTime, targetID);
+   runScenario(false, records, stops, unused, injectTime, removeTime, targetID);
+
+   //Every stop must be the first frame boundary at or after its requested time, and runUntil() must stop where stepping does
+   for(int stopIter = 0; stopIter < stops.size(); stopIter++){
+      double endTime = (stopIter == 2) ? injectTime + 20.5 : requested[stopIter];
+      int boundaryIter = lower_bound(boundaries.begin(), boundaries.end(), endTime) - boundaries.begin();
+      if(boundaryIter == boundaries.size() || boundaries[boundaryIter] != referenceStops[stopIter] || stops[stopIter] != referenceStops[stopIter]){
+         printf("runUntil(%.3f) ended at %.6f s, first frame boundary at or after it is %.6f s\n", endTime, stops[stopIter],
+                (boundaryIter < boundaries.size()) ? boundaries[boundaryIter] : -1.0);
+         passed = false;
+      }
+   }
+   if(records.size() != referenceRecords.size()){
+      cout << "runUntil() and frame stepping runs differ in amount of records" << endl;
+      passed = false;
+   }
+
+   int detections = 0;
+   int trackEvents = 0;
+   for(int recordIter = 0; recordIter < records.size(); recordIter++){
+      const embeddedRecord &record = records[recordIter];
+      if(record.targetID != targetID){
+         if(record.targetID != -1){
+            printf("Record of unknown target %d at %.6f s\n", record.targetID, record.time);
+            passed = false;
+         }
+         continue;
+      }
+      if(record.time < injectTime){
+         printf("Target %c record at %.6f s, before injection at %.6f s\n", record.kind, record.time, injectTime);
+         passed = false;
+      }
+      if(record.time >= removeTime){
+         printf("Target %c record at %.6f s, after removal at %.6f s\n", record.kind, record.time, removeTime);
+         passed = false;
+      }
+      if(record.kind == 'D'){
+         detections = detections + 1;
+      }
+      else{
+         trackEvents = trackEvents + 1;
+      }
+   }
+   cout << "Injected target at " << injectTime << " s, removed at " << removeTime << " s: " << detections
+        << " detection(s), " << trackEvents << " track event(s)" << endl;
+   if(detections == 0 || trackEvents == 0){
+      cout << "Injected target was never detected or tracked" << endl;
+      passed = false;
+   }
+   if(!passed){
+      cout << "Embedded simulation check failed" << endl;
+      return 1;
+   }
+   cout << "Embedded simulation check passed" << endl;
+   return 0;
+}
@@ -0,0 +1,79 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: falseAlarms.h contains the false alarm (noise clutter) generator of search beams. Instead of testing
+ *              every range resolution cell of a search beam against the detection threshold, the amount of false
+ *              alarms of a beam is drawn directly: with a probability of false alarm (Pfa) per cell and N range cells,
+ *              the count is binomial(N, Pfa), drawn as Poisson(N*Pfa) since Pfa is small (by inverse transform, or from its
+ *              normal approximation once the mean is large enough for exp(-mean) to lose precision). Only the alarms drawn are then
+ *              placed, each in a uniformly drawn range cell and uniformly within the search beam, so a realistic false
+ *              alarm load costs a single draw for most beams.
+ *              The SNR of a false alarm is that of a noise sample exceeding the detection threshold: noise power over
+ *              noise is exponentially distributed, so the SNR is -ln(Pfa) + Exp(1) (linear).
+ *              All draws come from the radar's counter-based generator keyed by search beam number, so false alarms
+ *              do not depend on targets.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef FALSEALARMS_H
+#define FALSEALARMS_H
+#include "counterRNG.h"
+#include "searchSector.h"
+#include <math.h>
+
+using namespace std;
+
+//Single false alarm of a search beam
+struct falseAlarm {
+   double range;        //Range of range cell alarm is in. (meters)
+   double azPos;        //Azimuth position of alarm within search beam. (degrees)
+   double elPos;        //Elevation position of alarm within search beam. (degrees)
+   double snr;          //SNR of noise sample exceeding threshold. (decible)
+};
+
+class falseAlarmGenerator {
+   public:
+      //Function draws amount of false alarms of a search beam. Draws use counters 0 and 1 of key
+      //Inputs: rng = radar's generator. key = random draw key of search beam. sector = sector beam was sent in
+      static int drawCount(counterRNG &rng, uint64_t key, searchSector* sector){
+         double mean = sector->getFalseAlarmPfa() * sector->getRangeCellCount();
+         if(mean <= 0){
+            return 0;
+         }
+         //Normal approximation of Poisson(mean) with continuity correction, accurate well before exp(-mean) underflows
+         if(mean > NORMAL_MEAN){
+            double count = floor(mean + sqrt(mean)*rng.normal(key, 0) + 0.5);
+            return (count > 0) ? (int)count : 0;
+         }
+         //Inverse transform of Poisson(mean). Loop ends once cumulative probability passes draw (bounded far into the tail)
+         double draw = rng.uniform(key, 0);
+         double probability = exp(-mean);
+         double cumulative = probability;
+         int count = 0;
+         int limit = (int)(mean + 20*sqrt(mean) + 20);
+         while(draw >= cumulative && count < limit){
+            count = count + 1;
+            probability = probability * mean / count;
+            cumulative = cumulative + probability;
+         }
+         return count;
+      }
+
+      //Function places one false alarm of a search beam
+      //Inputs: alarmIter = alarm number within beam. beamWidth = half power beamwidth of face, 0 = azimuth, 1 = elevation (degrees)
+      static falseAlarm drawAlarm(counterRNG &rng, uint64_t key, int alarmIter, searchSector* sector, const double beamWidth[2]){
+         uint64_t counter = 2 + 4*(uint64_t)alarmIter; //Counters 0 and 1 are the count draw
+         falseAlarm alarm;
+         long cellIter = (long)(rng.uniform(key, counter) * sector->getRangeCellCount());
+         alarm.range = sector->getRangeExtent(0) + (cellIter + 0.5)*sector->getRangeCellSize();
+         alarm.azPos = fmod(sector->getScanPOS(0) + (rng.uniform(key, counter + 1) - 0.5)*beamWidth[0] + 360, 360);
+         alarm.elPos = sector->getScanPOS(1) + (rng.uniform(key, counter + 2) - 0.5)*beamWidth[1];
+         double exceedance = -log(1 - rng.uniform(key, counter + 3));
+         alarm.snr = 10*log10(-log(sector->getFalseAlarmPfa()) + exceedance);
+         return alarm;
+      }
+
+   private:
+      static constexpr double NORMAL_MEAN = 30;   //Means above are drawn from normal approximation
+};
+
+#endif
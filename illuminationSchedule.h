@@ -0,0 +1,274 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: illuminationSchedule.h contains the search beam illumination schedule of a radar face's interval frame.
+ *              Search sectors raster deterministically (searchSector::incrementBeamPos()), so the positions of every
+ *              sector's next search beams are known in advance (the scan table), and targets move a bounded distance
+ *              during the frame (target::getMaxDisplacement(), as used by range culling). From a target's site
+ *              relative view at the start of the frame, the angles it can reach during the frame are bounded:
+ *                 elevation changes by at most asin(D/range), azimuth by at most asin(D/horizontal range)
+ *              for a displacement bound D. A target is scheduled on each search beam of the scan table whose beam
+ *              (scan position +- half the beamwidth) overlaps those angles; every other search beam skips the target
+ *              without propagating it. Scheduled targets are then tested exactly as before, so detections do not change.
+ *              Targets whose angles cannot be bounded (within D of the site or its vertical axis, or not yet active)
+ *              are scheduled on every search beam, and search beams beyond the scan table fall back to every candidate.
+ *              Target bounds can also be computed ahead of time for a longer window (truth stage of a pipelined simulation,
+ *              simulationPipeline.h) and adopted by the schedule, bounds of a longer window being looser but still conservative.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef ILLUMINATIONSCHEDULE_H
+#define ILLUMINATIONSCHEDULE_H
+#include "target.h"
+#include "radarSite.h"
+#include "radarFace.h"
+#include "searchSector.h"
+#include "simulationPlan.h"
+#include <vector>
+#include <algorithm>
+#include <math.h>
+
+using namespace std;
+
+//Angles a target can reach during a schedule window
+struct illuminationBounds {
+   double az[2];     //Azimuth bounds. 0 = lowest. 1 = highest. (degrees)
+   double el[2];     //Elevation bounds. 0 = lowest. 1 = highest. (degrees)
+};
+
+class illuminationSchedule {
+   public:
+      illuminationSchedule(){
+         buildTime = 0;
+         window = -1;
+         boundTime = 0;
+         boundWindow = -1;
+      }
+      ~illuminationSchedule(){}
+
+      //Function builds schedule of a radar face's sectors for a window starting at time. Sectors are only read
+      //Inputs: faceSectors = face's search sectors (faceEntry.sectorCount, consecutive in radar's sector table). candidates = targets each sector
+      //could detect (targetVector positions)
+      //Units: seconds
+      void build(const facePlan &faceEntry, searchSector** faceSectors, const vector< vector<int> > &candidates,
+                 vector<target*> &targets, radarSite &site, double time, double windowLength){
+         buildTime = time;
+         window = windowLength;
+         halfBeamWidth[0] = faceEntry.halfPowerBeamWidth[0]/2;
+         halfBeamWidth[1] = faceEntry.halfPowerBeamWidth[1]/2;
+         stepBeamWidth[0] = faceEntry.halfPowerBeamWidth[0];
+         stepBeamWidth[1] = faceEntry.halfPowerBeamWidth[1];
+         //Search beams a sector can send in window: sectors take turns, every search beam takes at least the face's shortest dwell
+         int visits = ceil(windowLength/faceEntry.minDwellTime/faceEntry.sectorCount) + 2;
+         //Target bounds do not depend on face, faces scheduled within the window of the current bounds share them
+         if(time < boundTime || time + windowLength > boundTime + boundWindow){
+            stamp = stamp + 1;
+            boundTime = time;
+            boundWindow = windowLength;
+         }
+         boundStamp.resize(targets.size(), 0);
+         bounds.resize(targets.size());
+         sectors.resize(faceEntry.sectorCount);
+         for(int sectorIter = 0; sectorIter < faceEntry.sectorCount; sectorIter++){
+            buildSector(sectors[sectorIter], faceSectors[sectorIter], candidates[sectorIter], targets, site, visits);
+         }
+      }
+
+      //Function takes target bounds computed ahead of time (computeBounds() of every target, by targetVector position) for a window
+      //starting at time. Bounds of a window hold for any window inside it, so schedules built inside it use them as they are.
+      //Table is swapped with the schedule's previous bounds
+      //Units: seconds
+      void adoptBounds(vector<illuminationBounds> &table, double time, double windowLength){
+         bounds.swap(table);
+         stamp = stamp + 1;
+         boundStamp.assign(bounds.size(), stamp);
+         boundTime = time;
+         boundWindow = windowLength;
+      }
+
+      //Function computes the angles a target can reach during a window starting at time, viewed from site. Target is only read
+      //Units: seconds
+      static void computeBounds(target* viewed, radarSite &site, double time, double windowLength, illuminationBounds &bound){
+         //Unbounded unless target's angles can be bounded below
+         bound.az[0] = -HUGE_VAL;
+         bound.az[1] = HUGE_VAL;
+         bound.el[0] = -HUGE_VAL;
+         bound.el[1] = HUGE_VAL;
+         if(viewed->isActiveAt(time) == false){
+            return;
+         }
+         targetView view;
+         site.getView(viewed, time, view);
+         //Displacement bound is an upper bound (target::getMaxDisplacement()), margin only covers rounding so the exact test
+         //never detects a target its bounds exclude
+         double displacement = viewed->getMaxDisplacement(time, windowLength)*1.01 + 1;
+         double range = view.polar[2];
+         double horizontalRange = sqrt(pow(view.xyz[0],2) + pow(view.xyz[1],2));
+         const double margin = 1e-6; //degrees
+         if(displacement < range){
+            double elChange = asin(displacement/range)*180/M_PI + margin;
+            bound.el[0] = view.polar[1] - elChange;
+            bound.el[1] = view.polar[1] + elChange;
+         }
+         if(displacement < horizontalRange){
+            double azChange = asin(displacement/horizontalRange)*180/M_PI + margin;
+            //Azimuth wraps at 0/360 degrees during window, target can be at either end
+            if(view.polar[0] - azChange > 0 && view.polar[0] + azChange < 360){
+               bound.az[0] = view.polar[0] - azChange;
+               bound.az[1] = view.polar[0] + azChange;
+            }
+         }
+      }
+
+      //Function determines if schedule is valid at time
+      //Unit: seconds
+      bool isValidAt(double time){
+         return time >= buildTime && time <= buildTime + window;
+      }
+
+      //Function gives the targets scheduled on a sector's next search beam. Past the scan table, every candidate is given
+      //Outputs: list = first target (targetVector positions), returns amount of targets, in candidate order
+      int getNextVisit(int sectorIter, const vector<int> &candidates, const int* &list){
+         sectorSchedule &schedule = sectors[sectorIter];
+         if(schedule.nextVisit >= schedule.visitCount){
+            list = candidates.data();
+            return candidates.size();
+         }
+         int first = schedule.visitStart[schedule.nextVisit];
+         list = schedule.visitTargets.data() + first;
+         return schedule.visitStart[schedule.nextVisit + 1] - first;
+      }
+
+      //Function moves a sector's schedule to its next search beam (called once per search beam sent in sector)
+      void advance(int sectorIter){
+         sectors[sectorIter].nextVisit = sectors[sectorIter].nextVisit + 1;
+      }
+
+   private:
+      //Schedule of one sector, scheduled targets of every search beam stored consecutively
+      struct sectorSchedule {
+         int visitCount;               //Search beams in scan table
+         int nextVisit;                //Scan table position of sector's next search beam
+         vector<double> scanAz;        //Azimuth scan position of every search beam. (degrees)
+         vector<double> scanEl;        //Elevation scan position of every search beam. (degrees)
+         vector<int> azOrder;          //Search beams sorted by azimuth scan position
+         vector<double> sortedAz;      //Azimuth scan positions of azOrder. (degrees)
+         vector<int> visitStart;       //First entry of every search beam in visitTargets (visitCount + 1 entries)
+         vector<int> visitTargets;     //Scheduled targets, by search beam, in candidate order
+         vector<int> pairVisit;        //Search beam of each (search beam, target) pair found, in target order
+         vector<int> pairTarget;       //Target of each pair
+      };
+
+      //Function grows storage to twice size once size no longer fits, so a schedule's storage settles at its working size instead of
+      //growing a little every time a frame schedules more beams/targets than any frame before
+      template <typename T>
+      static void reserveHeadroom(vector<T> &storage, size_t size){
+         if(storage.capacity() < size){
+            storage.reserve(2*size);
+         }
+      }
+
+      //Function builds one sector's scan table and schedules its candidates
+      void buildSector(sectorSchedule &schedule, searchSector* sector, const vector<int> &candidates, vector<target*> &targets,
+                       radarSite &site, int visits){
+         //Scan table, rastering a copy of the sector exactly as the search loop will
+         searchSector probe = *sector;
+         schedule.visitCount = visits;
+         schedule.nextVisit = 0;
+         reserveHeadroom(schedule.scanAz, visits);
+         reserveHeadroom(schedule.scanEl, visits);
+         reserveHeadroom(schedule.azOrder, visits);
+         reserveHeadroom(schedule.sortedAz, visits);
+         reserveHeadroom(schedule.visitStart, visits + 1);
+         reserveHeadroom(fill, visits);
+         reserveHeadroom(overlapping, visits);
+         //Pairs storage sized by candidates, only a fraction of a sector's candidates fall on the beams of one frame
+         reserveHeadroom(schedule.pairVisit, candidates.size());
+         reserveHeadroom(schedule.pairTarget, candidates.size());
+         reserveHeadroom(schedule.visitTargets, candidates.size());
+         schedule.scanAz.resize(visits);
+         schedule.scanEl.resize(visits);
+         for(int visitIter = 0; visitIter < visits; visitIter++){
+            schedule.scanAz[visitIter] = probe.getScanPOS(0);
+            schedule.scanEl[visitIter] = probe.getScanPOS(1);
+            probe.incrementBeamPos(stepBeamWidth[0], stepBeamWidth[1]);
+         }
+
+         schedule.azOrder.resize(visits);
+         for(int visitIter = 0; visitIter < visits; visitIter++){
+            schedule.azOrder[visitIter] = visitIter;
+         }
+         sort(schedule.azOrder.begin(), schedule.azOrder.end(), [&schedule](int left, int right){
+            return schedule.scanAz[left] < schedule.scanAz[right];
+         });
+         schedule.sortedAz.resize(visits);
+         for(int orderIter = 0; orderIter < visits; orderIter++){
+            schedule.sortedAz[orderIter] = schedule.scanAz[schedule.azOrder[orderIter]];
+         }
+
+         //Pairs of overlapping search beam and target, found candidate by candidate so each beam keeps candidate order
+         schedule.pairVisit.clear();
+         schedule.pairTarget.clear();
+         for(int candidateIter = 0; candidateIter < candidates.size(); candidateIter++){
+            int targetIter = candidates[candidateIter];
+            const illuminationBounds &bound = getBounds(targets, targetIter, site);
+            //Search beams whose azimuth overlaps target's, then elevation tested
+            int first = 0;
+            int last = visits;
+            if(bound.az[0] != -HUGE_VAL){
+               first = lower_bound(schedule.sortedAz.begin(), schedule.sortedAz.end(), bound.az[0] - halfBeamWidth[0]) - schedule.sortedAz.begin();
+               last = upper_bound(schedule.sortedAz.begin(), schedule.sortedAz.end(), bound.az[1] + halfBeamWidth[0]) - schedule.sortedAz.begin();
+            }
+            overlapping.clear();
+            for(int orderIter = first; orderIter < last; orderIter++){
+               int visitIter = schedule.azOrder[orderIter];
+               if(schedule.scanEl[visitIter] - halfBeamWidth[1] <= bound.el[1] && schedule.scanEl[visitIter] + halfBeamWidth[1] >= bound.el[0]){
+                  overlapping.push_back(visitIter);
+               }
+            }
+            sort(overlapping.begin(), overlapping.end());
+            for(int overlapIter = 0; overlapIter < overlapping.size(); overlapIter++){
+               schedule.pairVisit.push_back(overlapping[overlapIter]);
+               schedule.pairTarget.push_back(targetIter);
+            }
+         }
+
+         //Counting sort of pairs by search beam (stable, candidate order kept)
+         schedule.visitStart.assign(visits + 1, 0);
+         for(int pairIter = 0; pairIter < schedule.pairVisit.size(); pairIter++){
+            schedule.visitStart[schedule.pairVisit[pairIter] + 1]++;
+         }
+         for(int visitIter = 0; visitIter < visits; visitIter++){
+            schedule.visitStart[visitIter + 1] = schedule.visitStart[visitIter + 1] + schedule.visitStart[visitIter];
+         }
+         schedule.visitTargets.resize(schedule.pairTarget.size());
+         fill.assign(schedule.visitStart.begin(), schedule.visitStart.end() - 1);
+         for(int pairIter = 0; pairIter < schedule.pairVisit.size(); pairIter++){
+            schedule.visitTargets[fill[schedule.pairVisit[pairIter]]++] = schedule.pairTarget[pairIter];
+         }
+      }
+
+      //Function gives angles a target can reach during bounds window, computed once per window
+      const illuminationBounds& getBounds(vector<target*> &targets, int targetIter, radarSite &site){
+         illuminationBounds &bound = bounds[targetIter];
+         if(boundStamp[targetIter] != stamp){
+            boundStamp[targetIter] = stamp;
+            computeBounds(targets[targetIter], site, boundTime, boundWindow, bound);
+         }
+         return bound;
+      }
+
+      double buildTime;                      //Start of schedule window. (seconds)
+      double window;                         //Length of schedule window. (seconds)
+      double halfBeamWidth[2];               //Half of face's search beamwidth. 0 = azimuth. 1 = elevation. (degrees)
+      double stepBeamWidth[2];               //Beamwidth sectors step their scan positions by. 0 = azimuth. 1 = elevation. (degrees)
+      vector<sectorSchedule> sectors;        //Schedule of every sector of face
+      vector<illuminationBounds> bounds;     //Angle bounds of targets, by targetVector position
+      vector<uint64_t> boundStamp;           //Bounds window each target's bounds were computed for
+      uint64_t stamp = 0;                    //Current bounds window
+      double boundTime;                      //Start of window target bounds were computed for. (seconds)
+      double boundWindow;                    //Length of window target bounds were computed for. (seconds)
+      vector<int> fill;                      //Next free entry of every search beam during counting sort
+      vector<int> overlapping;               //Search beams overlapping current target during build
+};
+
+#endif
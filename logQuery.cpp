@@ -0,0 +1,88 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: logQuery.cpp answers time/face/sector queries over a detection log (detectionLog.h) written during a run,
+ *              e.g. every detection of face 1, sector 2 between minute 30 and 40. Only the log's indexes and the
+ *              face/sector groups overlapping the time window are read, so queries on multi-gigabyte logs of long runs
+ *              read a small part of the file.
+ *                 g++ -O2 -std=c++17 logQuery.cpp -o logQuery
+ *                 ./logQuery outputFiles/searchData.rdl --from 30 --to 40 --face 1 --sector 2
+ *                 ./logQuery outputFiles/searchData.rdl --tracks --from 30 --to 40
+ *              Times are in minutes, face and sector numbers as printed by searchDataOutput. Without --face/--sector every
+ *              face/sector matches; with --tracks, track events are listed instead of detections (--face -1 for track
+ *              beams at start of frame). --count prints only the amount of matches.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "detectionLog.h"
+#include <stdio.h>
+#include <float.h>
+
+using namespace std;
+
+int main(int argc, char** argv){
+   if(argc < 2){
+      cout << "Usage: " << argv[0] << " log.rdl [--from minutes] [--to minutes] [--face N] [--sector N] [--tracks] [--count]" << endl;
+      return 1;
+   }
+   string logName = argv[1];
+   double startTime = -DBL_MAX;
+   double endTime = DBL_MAX;
+   int faceIter = LOG_ANY;
+   int sectorIter = LOG_ANY;
+   bool tracks = false;
+   bool countOnly = false;
+   for(int argIter = 2; argIter < argc; argIter++){
+      string option = argv[argIter];
+      if(option == "--tracks") tracks = true;
+      else if(option == "--count") countOnly = true;
+      else if(argIter + 1 < argc && option == "--from") startTime = atof(argv[++argIter])*60;
+      else if(argIter + 1 < argc && option == "--to") endTime = atof(argv[++argIter])*60;
+      else if(argIter + 1 < argc && option == "--face") faceIter = atoi(argv[++argIter]);
+      else if(argIter + 1 < argc && option == "--sector") sectorIter = atoi(argv[++argIter]);
+      else{
+         cout << "Error, unknown option " << option << endl;
+         return 1;
+      }
+   }
+
+   detectionLogReader reader;
+   if(reader.open(logName) == false){
+      cout << "Error, " << logName << " is not a complete detection log" << endl;
+      return 1;
+   }
+
+   long matches = 0;
+   if(tracks == false){
+      vector<loggedDetection> detections;
+      if(reader.queryDetections(startTime, endTime, faceIter, sectorIter, detections) == false){
+         cout << "Error, " << logName << " is malformed" << endl;
+         return 1;
+      }
+      matches = detections.size();
+      for(int recordIter = 0; recordIter < detections.size() && countOnly == false; recordIter++){
+         const loggedDetection &detection = detections[recordIter];
+         cout << "Detection(" << detection.azPos << "," << detection.elPos << ") at: " << detection.time/60 << "mins on, face " << detection.faceIter
+              << "-> sector " << detection.sectorIter << ", SNR " << detection.snr << "dB, target " << detection.targetID << endl;
+      }
+   }
+   else{
+      vector<loggedTrackEvent> events;
+      if(reader.queryTrackEvents(startTime, endTime, faceIter, events) == false){
+         cout << "Error, " << logName << " is malformed" << endl;
+         return 1;
+      }
+      matches = events.size();
+      const char* types[3] = {"started", "updated", "lost"};
+      for(int eventIter = 0; eventIter < events.size() && countOnly == false; eventIter++){
+         const loggedTrackEvent &event = events[eventIter];
+         cout << "Track " << ((event.type >= 0 && event.type < 3) ? types[event.type] : "?") << " at: " << event.time/60 << "mins, target "
+              << event.targetID << ", face " << event.faceIter << ", next beam (" << event.nextScanAz << "," << event.nextScanEl << ")" << endl;
+      }
+   }
+   if(countOnly == true){
+      cout << matches << endl;
+   }
+   fprintf(stderr, "%ld match(es), %llu block byte(s) read\n", matches, (unsigned long long)reader.getBytesRead());
+   return 0;
+}
@@ -23,6 +23,9 @@
  *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "configManager.h"
+#include "radarNetwork.h"
+#include "shardedSimulation.h"
+#include "detectionLog.h"
 #include <time.h>
 
 using namespace std;
@@ -37,16 +40,51 @@ int main() {
     test1.inputFaceFile("inputFiles/FaceInfo.txt"); //File containing radarFace.h parameter data
     test1.inputSectorFile("inputFiles/SectorInfo.txt"); //File containing searchSector.h parameter data
     test1.inputTargetFile("inputFiles/TargetInfo.txt"); //File containing target.h parameter data
+    //test1.inputTrajectoryFile("inputFiles/Trajectories.wpt"); //Optional binary file containing recorded target trajectories (trajectoryTarget.h)
 
     radar simRadar; //Creating radar object to be simulated
     test1.initializeInputData(simRadar); //Assigns parameter data from .txt files above to simuated radar object
     //simRadar.printSimInfo(simRadar);   //Optional function, prints to console all parameter/characteristic data gathered from .txt files to radar object
+    //simRadar.setDetectionModel(SWERLING_1, 1e-6); //Optional function, probabilistic Swerling detection (default is hard SNR threshold)
+    //simRadar.setAntennaPattern(PATTERN_SINC2, 1.5); //Optional function, search/track beams lose gain off beam center (sinc^2 or Gaussian pattern) and cos^n scan loss off face boresight
+    //simRadar.setPlotExtraction(true); //Optional function, merges search detections of the same/adjacent beams into plots, tracks are started from plots (see plotDataOutput below)
+    //simRadar.setPlotClusterLimits(0.5, 3); //Optional function, bounds a plot to hits within 0.5 seconds and 3 beamwidths
+    //simRadar.setMeasurementAssociation(true); //Optional function, tracks are kept by associating noisy track beam measurements to tracks (setMeasurementNoise/setAssociationGate take lengths, e.g. 30 * units::m)
+    //simRadar.setTrackCoasting(2); //Optional function, tracks coast through up to 2 missed track beams before they are lost and dropped (default parks lost tracks, without track beams, until a search detection re-confirms them)
+    //simRadar.setRealTimeMode(1);      //Optional function, paces simulation against the wall clock (1 = real-time) and reports deadline misses/emit latency
+    //simRadar.setPipelinedExecution(true); //Optional function, culling/scheduling builds and record output run on their own threads alongside search/track beams (same results, only faster with spare cores)
+    //simRadar.reserveTracks(simRadar.getTargetVector().size()); //Optional function, allocates track storage ahead of time so frames do not allocate (see allocationCheck.cpp)
+    
+    //radarNetwork network;            //Optional, network of radar sites sharing one target table. Each site is a radar configured as above (site position/heading in RadarInfo.txt)
+    //network.addSite(simRadar);       //Optional function, adds radar as a network site. Sites are then run in parallel by network.startSimulation() instead of simRadar.startSimulation()
+    //radar siteTwo;                   //Optional, further network site. Configured from its own input files without targets, first site's targets are shared
+    //siteConfig.initializeSiteData(siteTwo); //Optional function, assigns radar/face/sector .txt data only (siteConfig = configManager with the site's RadarInfo/FaceInfo/SectorInfo files)
+    //network.addSite(siteTwo);        //Optional function, adds second site observing the same targets
+    
+    //shardedSimulation sharded(simRadar, 4); //Optional, splits targets across 4 worker processes. Run with sharded.startSimulation() instead of simRadar.startSimulation()
+    
+    //detectionLogWriter searchLog;    //Optional, compressed binary search detection/track event log (read back with detectionLogReader)
+    //searchLog.open("outputFiles/searchData.rdl"); //Optional function, opens compressed search detection log
+    //simRadar.setDetectionCallback(detectionLogWriter::logDetection, &searchLog); //Optional function, streams every search detection to log during simulation
+    //simRadar.setTrackEventCallback(detectionLogWriter::logTrackEvent, &searchLog); //Optional function, streams every track event to log (query logs with logQuery.cpp)
+    
+    //coverageMap coverage(360, 90);   //Optional, per-face coverage heatmaps (1 degree cells) of search beams, detections and mean SNR accumulated during simulation
+    //simRadar.setCoverageMap(&coverage); //Optional function, radar accumulates search beams/detections into coverage map
+    
+    //telemetryFeed feed;              //Optional, live telemetry of search beams, detections and track events for local viewers (telemetryViewer.cpp)
+    //feed.open("/radarsim");          //Optional function, creates shared memory feed /radarsim (closed when feed goes out of scope)
+    //simRadar.setTelemetryFeed(&feed); //Optional function, radar publishes to feed during simulation without waiting for viewers
     
     //Start of simulation
     simRadar.startSimulation(); //Function starts radar simulation for created radar object
 
     //Post simulation
     //test1.searchDataOutput(simRadar,"outputFiles/searchData.txt"); //Optional function, prints simulation search data to .txt file  
+    //test1.plotDataOutput(simRadar,"outputFiles/plotData.txt"); //Optional function, prints extracted plots to .txt file (requires plot extraction)
+    //coverage.writeBinary("outputFiles/coverage.rcov"); //Optional function, writes coverage heatmaps of every face as a binary grid
+    //coverage.writePGM("outputFiles/coverageFace1.pgm", 0, COVERAGE_DETECTIONS); //Optional function, writes one face's heatmap layer as a PGM image
+    //searchLog.close();              //Optional function, writes block index and closes compressed search detection log
+    printPerfReport(cout); //Prints hardware performance counters per simulation phase (only when built with -DRADARSIM_PERF_COUNTERS)
     test1.closeInputFiles(); //Closes all files (from above) used to input data for simulation
     
     return 0;
@@ -0,0 +1,249 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: perfCounters.h contains optional hardware performance counter sampling per simulation phase, using
+ *              Linux perf_event_open. Cycles, instructions, cache misses and branch misses are read (as one counter
+ *              group) on every phase change and added to the phase being left, so phases are exclusive: time spent
+ *              emitting a record inside the search phase is counted as output, not search. Phases:
+ *                 track servicing = track/confirmation beams serviced at start of frame
+ *                 propagation     = target states propagated to frame time for range culling
+ *                 search          = search beams and detection tests
+ *                 output          = record emission (callbacks, buffers, history) and post simulation output
+ *              Counters are per thread (radar network sites running on worker threads are summed when the threads end),
+ *              worker processes of a sharded simulation are not counted.
+ *              Counting is compiled in with -DRADARSIM_PERF_COUNTERS. Without it PERF_PHASE() expands to nothing and
+ *              printPerfReport() does nothing, so a default build has no counter overhead.
+ *              Counting needs perf events to be permitted (kernel.perf_event_paranoid <= 2 for user space counts of own
+ *              thread, some containers block perf_event_open entirely); otherwise a warning is printed and nothing is counted.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+#include <iostream>
+#include <stdint.h>
+
+using namespace std;
+
+//Simulation phases counters are collected for
+enum perfPhase {
+   PHASE_NONE = 0,         //Outside of any phase (setup, caller code)
+   PHASE_TRACK = 1,        //Track servicing
+   PHASE_PROPAGATION = 2,  //Target propagation for range culling
+   PHASE_SEARCH = 3,       //Search beams and detection tests
+   PHASE_OUTPUT = 4,       //Record emission and post simulation output
+   PHASE_COUNT = 5
+};
+
+#ifdef RADARSIM_PERF_COUNTERS
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <mutex>
+#include <iomanip>
+
+//Counted hardware events
+enum perfEvent {
+   EVENT_CYCLES = 0,
+   EVENT_INSTRUCTIONS = 1,
+   EVENT_CACHE_MISSES = 2,
+   EVENT_BRANCH_MISSES = 3,
+   EVENT_COUNT = 4
+};
+
+class perfCounters {
+   public:
+      perfCounters(){
+         currentPhase = PHASE_NONE;
+         memset(totals, 0, sizeof(totals));
+         memset(last, 0, sizeof(last));
+         for(int eventIter = 0; eventIter < EVENT_COUNT; eventIter++){
+            fds[eventIter] = -1;
+         }
+         openCounters();
+      }
+      ~perfCounters(){
+         if(fds[0] >= 0){
+            switchPhase(PHASE_NONE);
+            mergeIntoProcess();
+         }
+         for(int eventIter = 0; eventIter < EVENT_COUNT; eventIter++){
+            if(fds[eventIter] >= 0){
+               close(fds[eventIter]);
+            }
+         }
+      }
+
+      //Gets counters of calling thread
+      static perfCounters& local(){
+         static thread_local perfCounters counters;
+         return counters;
+      }
+
+      //Function makes a phase current, adding counts since last change to the phase being left. Returns phase left
+      perfPhase switchPhase(perfPhase phase){
+         perfPhase previous = currentPhase;
+         if(fds[0] < 0){
+            currentPhase = phase;
+            return previous;
+         }
+         uint64_t now[EVENT_COUNT];
+         if(readCounters(now) == true){
+            for(int eventIter = 0; eventIter < EVENT_COUNT; eventIter++){
+               totals[currentPhase][eventIter] = totals[currentPhase][eventIter] + (now[eventIter] - last[eventIter]);
+               last[eventIter] = now[eventIter];
+            }
+         }
+         currentPhase = phase;
+         return previous;
+      }
+
+      //Function prints counts of every phase, summed over ended threads and calling thread
+      static void printReport(ostream &out){
+         perfCounters &counters = local();
+         counters.switchPhase(counters.currentPhase); //Bringing calling thread's counts up to date
+         uint64_t sums[PHASE_COUNT][EVENT_COUNT];
+         {
+            lock_guard<mutex> lock(processMutex());
+            for(int phaseIter = 0; phaseIter < PHASE_COUNT; phaseIter++){
+               for(int eventIter = 0; eventIter < EVENT_COUNT; eventIter++){
+                  sums[phaseIter][eventIter] = processTotals()[phaseIter][eventIter] + counters.totals[phaseIter][eventIter];
+               }
+            }
+         }
+         if(counters.fds[0] < 0 && sums[PHASE_SEARCH][EVENT_CYCLES] == 0){
+            out << "Performance counters unavailable" << endl;
+            return;
+         }
+         const char* names[PHASE_COUNT] = {"other", "track servicing", "propagation", "search", "output"};
+         uint64_t allCycles = 0;
+         for(int phaseIter = 0; phaseIter < PHASE_COUNT; phaseIter++){
+            allCycles = allCycles + sums[phaseIter][EVENT_CYCLES];
+         }
+         out << "Performance counters per phase:" << endl;
+         out << left << setw(17) << "phase" << right << setw(16) << "cycles" << setw(8) << "share" << setw(16) << "instructions"
+             << setw(7) << "IPC" << setw(14) << "cache misses" << setw(15) << "branch misses" << endl;
+         for(int phaseIter = 1; phaseIter <= PHASE_COUNT; phaseIter++){
+            int phase = phaseIter % PHASE_COUNT; //"other" listed last
+            const uint64_t* counts = sums[phase];
+            double share = (allCycles > 0) ? (100.0*counts[EVENT_CYCLES])/allCycles : 0;
+            double ipc = (counts[EVENT_CYCLES] > 0) ? (double)counts[EVENT_INSTRUCTIONS]/counts[EVENT_CYCLES] : 0;
+            out << left << setw(17) << names[phase] << right << setw(16) << counts[EVENT_CYCLES] << setw(7) << fixed << setprecision(1) << share << "%"
+                << setw(16) << counts[EVENT_INSTRUCTIONS] << setw(7) << setprecision(2) << ipc << setw(14) << counts[EVENT_CACHE_MISSES]
+                << setw(15) << counts[EVENT_BRANCH_MISSES] << endl;
+            out.unsetf(ios::fixed);
+         }
+      }
+
+   private:
+      //Function opens counter group of calling thread (any CPU), cycles is group leader
+      void openCounters(){
+         uint64_t configs[EVENT_COUNT] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+         for(int eventIter = 0; eventIter < EVENT_COUNT; eventIter++){
+            struct perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = configs[eventIter];
+            attr.disabled = (eventIter == 0) ? 1 : 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            fds[eventIter] = syscall(__NR_perf_event_open, &attr, 0, -1, (eventIter == 0) ? -1 : fds[0], 0);
+            if(fds[eventIter] < 0){
+               warnUnavailable();
+               for(int closeIter = 0; closeIter < eventIter; closeIter++){
+                  close(fds[closeIter]);
+                  fds[closeIter] = -1;
+               }
+               return;
+            }
+         }
+         ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+         ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+         readCounters(last);
+      }
+
+      //Function reads counter group. Returns false on a short read
+      bool readCounters(uint64_t values[EVENT_COUNT]){
+         uint64_t buffer[1 + EVENT_COUNT];  //Number of counters, then counter values
+         if(read(fds[0], buffer, sizeof(buffer)) != (ssize_t)sizeof(buffer)){
+            return false;
+         }
+         for(int eventIter = 0; eventIter < EVENT_COUNT; eventIter++){
+            values[eventIter] = buffer[1 + eventIter];
+         }
+         return true;
+      }
+
+      //Function adds thread's counts to process totals (thread is ending)
+      void mergeIntoProcess(){
+         lock_guard<mutex> lock(processMutex());
+         for(int phaseIter = 0; phaseIter < PHASE_COUNT; phaseIter++){
+            for(int eventIter = 0; eventIter < EVENT_COUNT; eventIter++){
+               processTotals()[phaseIter][eventIter] = processTotals()[phaseIter][eventIter] + totals[phaseIter][eventIter];
+            }
+         }
+      }
+
+      //Function prints one warning per process when perf_event_open is not permitted
+      static void warnUnavailable(){
+         static bool warned = false;
+         lock_guard<mutex> lock(processMutex());
+         if(warned == false){
+            cout << "Warning, perf_event_open failed (" << strerror(errno) << "), performance counters are not collected" << endl;
+            warned = true;
+         }
+      }
+
+      static mutex& processMutex(){
+         static mutex lock;
+         return lock;
+      }
+
+      //Counts of threads that have ended
+      static uint64_t (&processTotals())[PHASE_COUNT][EVENT_COUNT]{
+         static uint64_t sums[PHASE_COUNT][EVENT_COUNT] = {};
+         return sums;
+      }
+
+      int fds[EVENT_COUNT];                        //Counter file descriptors, fds[0] is group leader (-1 if unavailable)
+      perfPhase currentPhase;                      //Phase counts are currently added to
+      uint64_t last[EVENT_COUNT];                  //Counter values at last phase change
+      uint64_t totals[PHASE_COUNT][EVENT_COUNT];   //Counts of every phase
+};
+
+//Makes a phase current for the rest of a scope, restoring the enclosing phase when the scope ends
+class perfPhaseScope {
+   public:
+      perfPhaseScope(perfPhase phase){
+         previous = perfCounters::local().switchPhase(phase);
+      }
+      ~perfPhaseScope(){
+         perfCounters::local().switchPhase(previous);
+      }
+   private:
+      perfPhase previous;     //Phase current before scope
+};
+
+#define PERF_CONCAT_INNER(a, b) a##b
+#define PERF_CONCAT(a, b) PERF_CONCAT_INNER(a, b)
+#define PERF_PHASE(phase) perfPhaseScope PERF_CONCAT(perfScope, __LINE__)(phase)
+
+//Function prints counts of every phase
+inline void printPerfReport(ostream &out){
+   perfCounters::printReport(out);
+}
+
+#else
+
+#define PERF_PHASE(phase)
+
+//Function prints counts of every phase (counters not compiled in)
+inline void printPerfReport(ostream &){}
+
+#endif
+
+#endif
@@ -0,0 +1,259 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: plotExtractor.h contains the plot extraction stage run after search detection. Every target hit by a
+ *              search beam is a separate search detection, so several targets in one beam (or one target straddling
+ *              two beams) give several detections of what a real radar reports as one plot. The extractor collects the
+ *              detections of one radar face over one frame and clusters hits of the same search beam and of adjacent
+ *              beam positions into a single plot with an SNR weighted centroid and aggregate (summed power) SNR.
+ *              Beam positions are mapped to cells of the face's beam grid (one cell per half power beamwidth), hits
+ *              sharing a cell or in neighbouring cells of the same sector are joined (union-find) through a sorted
+ *              table of cells, so grouping is n log n in the amount of hits and reuses its storage every frame.
+ *              Joining is bounded so dense scenes do not chain neighbouring targets into one plot across a frame: two
+ *              clusters are only joined if the merged cluster spans at most maxSpan beam cells in azimuth and elevation
+ *              and its hits' search beams were sent within dwellWindow of each other (setClusterLimits()).
+ *              Plots are extracted by the radar's simulation thread once a face's search beams of a frame are sent: the
+ *              radar starts tracks from plots (one confirmation beam per plot, for the target of its strongest hit) and
+ *              outputs them (plot callback, searchDataOutput, plotDataOutput).
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef PLOTEXTRACTOR_H
+#define PLOTEXTRACTOR_H
+#include "simulationRecords.h"
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <stdint.h>
+#include <math.h>
+#include <stdlib.h>
+
+using namespace std;
+
+class plotExtractor {
+   public:
+      plotExtractor(){
+         frameTime = 0;
+         faceIter = -1;
+         dwellWindow = 0.5;
+         maxSpan = 3;
+      }
+      ~plotExtractor(){}
+
+      //Function sets bounds of a single plot. Clusters are not joined if the merged cluster would span more than beams beam cells
+      //in azimuth or elevation, or hits whose search beams were sent more than seconds apart
+      //Inputs: seconds = dwell-time window. beams = largest angular span (beamwidths)
+      void setClusterLimits(double seconds, int beams){
+         if(seconds < 0 || beams < 1){
+            cout << "Error, plot clusters need a positive dwell-time window and span of at least one beam" << endl;
+            exit(1);
+         }
+         dwellWindow = seconds;
+         maxSpan = beams;
+      }
+
+      //Function adds a search detection to the plots being extracted. Detections of a new frame/face first flush the pending
+      //plots into plots
+      //Inputs: record = search detection. beamWidth = half power beamwidth of detecting face, 0 = azimuth, 1 = elevation (degrees)
+      void addHit(const searchDetectRecord &record, const double beamWidth[2], vector<plotRecord> &plots){
+         if(hits.empty() == false && (record.time != frameTime || record.faceIter != faceIter)){
+            flush(plots);
+         }
+         frameTime = record.time;
+         faceIter = record.faceIter;
+         azCellCount = max((int64_t)1, (int64_t)llround(360/beamWidth[0]));
+         hitCells.push_back(cellOf(record, beamWidth));
+         hits.push_back(record);
+      }
+
+      //Function clusters pending hits into plots (appended to plots) and empties pending hits
+      void flush(vector<plotRecord> &plots){
+         if(hits.empty()){
+            return;
+         }
+         //Per hit storage follows pending hits' capacity, so it only grows when pending hits storage grows
+         if(cellTable.capacity() < hits.capacity()){
+            cellTable.reserve(hits.capacity());
+            parent.reserve(hits.capacity());
+            extents.reserve(hits.capacity());
+            plotIters.reserve(hits.capacity());
+            weights.reserve(hits.capacity());
+            azOffsets.reserve(hits.capacity());
+            elSums.reserve(hits.capacity());
+            peakSnr.reserve(hits.capacity());
+         }
+
+         //Sorting every hit's beam cell key, then joining hits of the same or neighbouring cells
+         cellTable.resize(hits.size());
+         parent.resize(hits.size());
+         extents.resize(hits.size());
+         for(int hitIter = 0; hitIter < hits.size(); hitIter++){
+            const hitCell &cell = hitCells[hitIter];
+            cellTable[hitIter] = make_pair(cellKey(cell.sector, cell.az, cell.el), hitIter);
+            parent[hitIter] = hitIter;
+            clusterExtent &extent = extents[hitIter];
+            extent.az = cell.az;
+            extent.azSpan[0] = 0;
+            extent.azSpan[1] = 0;
+            extent.elSpan[0] = cell.el;
+            extent.elSpan[1] = cell.el;
+            extent.dwell[0] = hits[hitIter].dwellTime;
+            extent.dwell[1] = hits[hitIter].dwellTime;
+         }
+         sort(cellTable.begin(), cellTable.end());
+         for(int hitIter = 0; hitIter < hits.size(); hitIter++){
+            const hitCell &cell = hitCells[hitIter];
+            for(int azStep = -1; azStep <= 1; azStep++){
+               for(int elStep = -1; elStep <= 1; elStep++){
+                  uint64_t key = cellKey(cell.sector, cell.az + azStep, cell.el + elStep);
+                  vector< pair<uint64_t,int> >::iterator found = lower_bound(cellTable.begin(), cellTable.end(), make_pair(key, -1));
+                  for(; found != cellTable.end() && found->first == key; ++found){
+                     join(hitIter, found->second);
+                  }
+               }
+            }
+         }
+
+         //Aggregating every cluster into a plot, in order of cluster's first hit
+         plotIters.assign(hits.size(), -1);
+         weights.clear();
+         azOffsets.clear();
+         elSums.clear();
+         peakSnr.clear();
+         int firstPlot = plots.size();
+         for(int hitIter = 0; hitIter < hits.size(); hitIter++){
+            int root = findRoot(hitIter);
+            const searchDetectRecord &hit = hits[hitIter];
+            double power = pow(10, hit.snr/10);
+            if(plotIters[root] == -1){
+               plotIters[root] = plots.size() - firstPlot;
+               plotRecord plot;
+               plot.time = hit.time;
+               plot.dwellTime = hit.dwellTime;
+               plot.snr = hit.snr;
+               plot.azPos = hit.azPos;
+               plot.elPos = hit.elPos;
+               plot.faceIter = hit.faceIter;
+               plot.sectorIter = hit.sectorIter;
+               plot.hitCount = 0;
+               plot.detectedTarget = hit.detectedTarget;
+               plots.push_back(plot);
+               weights.push_back(0);
+               azOffsets.push_back(0);
+               elSums.push_back(0);
+               peakSnr.push_back(hit.snr);
+            }
+            int plotIter = plotIters[root];
+            plotRecord &plot = plots[firstPlot + plotIter];
+            double azOffset = fmod(hit.azPos - plot.azPos + 540, 360) - 180;
+            weights[plotIter] = weights[plotIter] + power;
+            azOffsets[plotIter] = azOffsets[plotIter] + power*azOffset;
+            elSums[plotIter] = elSums[plotIter] + power*hit.elPos;
+            plot.dwellTime = min(plot.dwellTime, hit.dwellTime);
+            plot.hitCount = plot.hitCount + 1;
+            if(hit.snr > peakSnr[plotIter]){
+               peakSnr[plotIter] = hit.snr;
+               plot.detectedTarget = hit.detectedTarget;
+            }
+         }
+         for(int plotIter = 0; plotIter < weights.size(); plotIter++){
+            plotRecord &plot = plots[firstPlot + plotIter];
+            plot.azPos = fmod(plot.azPos + azOffsets[plotIter]/weights[plotIter] + 360, 360);
+            plot.elPos = elSums[plotIter]/weights[plotIter];
+            plot.snr = 10*log10(weights[plotIter]);
+            plot.peakSnr = peakSnr[plotIter];
+         }
+         hits.clear();
+         hitCells.clear();
+      }
+
+   private:
+      //Beam grid cell of a hit
+      struct hitCell {
+         int sector;
+         int64_t az;
+         int64_t el;
+      };
+
+      //Angular and dwell-time extent of a cluster, kept by cluster root
+      struct clusterExtent {
+         int64_t az;          //Reference azimuth cell, azimuth span is relative to it (azimuth wrap safe)
+         int64_t azSpan[2];   //Lowest/highest azimuth cell offset from reference
+         int64_t elSpan[2];   //Lowest/highest elevation cell
+         double dwell[2];     //Earliest/latest search beam time. (seconds)
+      };
+
+      //Function gets beam grid cell of a search detection. Adjacent beams are one half power beamwidth apart
+      hitCell cellOf(const searchDetectRecord &record, const double beamWidth[2]){
+         hitCell cell;
+         cell.sector = record.sectorIter;
+         cell.az = llround(record.azPos/beamWidth[0]);
+         cell.el = llround(record.elPos/beamWidth[1]);
+         return cell;
+      }
+
+      //Function packs a cell into a sort key of cell table, azimuth cells wrap around 360 degrees
+      uint64_t cellKey(int sector, int64_t az, int64_t el){
+         az = ((az % azCellCount) + azCellCount) % azCellCount;
+         return ((uint64_t)sector << 48) ^ ((uint64_t)(az & 0xFFFFFF) << 24) ^ (uint64_t)(el & 0xFFFFFF);
+      }
+
+      //Function finds cluster a hit belongs to (path halving)
+      int findRoot(int hitIter){
+         while(parent[hitIter] != hitIter){
+            parent[hitIter] = parent[parent[hitIter]];
+            hitIter = parent[hitIter];
+         }
+         return hitIter;
+      }
+
+      //Function joins clusters of two hits unless merged cluster exceeds cluster limits, lower hit index stays root so plots keep order
+      //of detections
+      void join(int first, int second){
+         int firstRoot = findRoot(first);
+         int secondRoot = findRoot(second);
+         if(firstRoot == secondRoot){
+            return;
+         }
+         if(secondRoot < firstRoot){
+            swap(firstRoot, secondRoot);
+         }
+         clusterExtent &kept = extents[firstRoot];
+         const clusterExtent &joined = extents[secondRoot];
+         //Joined cluster's reference azimuth cell from kept cluster's reference, shortest way around 360 degrees
+         int64_t offset = (((joined.az - kept.az) % azCellCount) + azCellCount) % azCellCount;
+         if(offset > azCellCount/2){
+            offset = offset - azCellCount;
+         }
+         int64_t azSpan[2] = {min(kept.azSpan[0], joined.azSpan[0] + offset), max(kept.azSpan[1], joined.azSpan[1] + offset)};
+         int64_t elSpan[2] = {min(kept.elSpan[0], joined.elSpan[0]), max(kept.elSpan[1], joined.elSpan[1])};
+         double dwell[2] = {min(kept.dwell[0], joined.dwell[0]), max(kept.dwell[1], joined.dwell[1])};
+         if(azSpan[1] - azSpan[0] >= maxSpan || elSpan[1] - elSpan[0] >= maxSpan || dwell[1] - dwell[0] > dwellWindow){
+            return;
+         }
+         kept.azSpan[0] = azSpan[0];
+         kept.azSpan[1] = azSpan[1];
+         kept.elSpan[0] = elSpan[0];
+         kept.elSpan[1] = elSpan[1];
+         kept.dwell[0] = dwell[0];
+         kept.dwell[1] = dwell[1];
+         parent[secondRoot] = firstRoot;
+      }
+
+      double frameTime;                         //Frame time of pending hits. (seconds)
+      int faceIter;                             //Radar face of pending hits
+      int64_t azCellCount;                      //Amount of azimuth cells around 360 degrees
+      double dwellWindow;                       //Longest time between search beams of one plot. (seconds)
+      int64_t maxSpan;                          //Largest azimuth/elevation span of one plot. (beam cells)
+      vector<searchDetectRecord> hits;          //Pending hits of current frame/face
+      vector<hitCell> hitCells;                 //Beam grid cell of each pending hit
+      vector< pair<uint64_t,int> > cellTable;   //Beam grid cell key of every hit with hit, sorted by cell
+      vector<int> parent;                       //Union-find parent of each hit
+      vector<clusterExtent> extents;            //Extent of each cluster root
+      vector<int> plotIters;                    //Plot of each cluster root
+      vector<double> weights;                   //Summed linear SNR of each plot being aggregated
+      vector<double> azOffsets;                 //Weighted azimuth offsets from plot's first hit (azimuth wrap safe)
+      vector<double> elSums;                    //Weighted elevation sums
+      vector<double> peakSnr;                   //Largest SNR hit of each plot
+};
+
+#endif
@@ -0,0 +1,34 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: precision.h contains the precision policy used for stored simulation state. Bulk state of targets,
+ *              tracks, faces and sectors (positions, velocities, angles in degrees, SNR in decibles, scan positions) is
+ *              stored as precisionPolicy::stateReal, while simulation time and other precision-sensitive accumulations
+ *              are always declared double. Arithmetic is still carried out in double; only storage changes.
+ *              The default build stores state as double. Building with -DRADARSIM_FLOAT_STATE stores state as float,
+ *              halving the memory (and memory bandwidth) of bulk state. precisionCompare.cpp compares a float build
+ *              against a double build.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef PRECISION_H
+#define PRECISION_H
+
+//Double precision state storage (default)
+struct doublePrecision {
+   typedef double stateReal;  //Stored state (positions, velocities, angles, SNR)
+};
+
+//Single precision state storage, time stays double
+struct floatPrecision {
+   typedef float stateReal;   //Stored state (positions, velocities, angles, SNR)
+};
+
+#ifdef RADARSIM_FLOAT_STATE
+typedef floatPrecision precisionPolicy;
+#else
+typedef doublePrecision precisionPolicy;
+#endif
+
+typedef precisionPolicy::stateReal stateReal;
+
+#endif
@@ -0,0 +1,186 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: precisionCompare.cpp validates the accuracy of a float state build (precision.h) against the default
+ *              double build. The same program is built twice:
+ *                 g++ -O2 -std=c++17 -pthread precisionCompare.cpp -o compareDouble
+ *                 g++ -O2 -std=c++17 -pthread -DRADARSIM_FLOAT_STATE precisionCompare.cpp -o compareFloat
+ *              Each build runs the inputFiles scenario with a fixed seed and writes every search detection and track
+ *              event to a log ("run" mode). "compare" mode then matches the two logs record by record and reports
+ *              detections/track events found by only one build and the largest SNR and track beam differences.
+ *                 ./compareDouble run double.log
+ *                 ./compareFloat run float.log
+ *                 ./compareDouble compare double.log float.log
+ *              Adding "decoupled" after the log name runs with a decoupled beam timeline, so a detection that differs
+ *              between builds does not shift the search beams of every other target.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "configManager.h"
+#include <stdio.h>
+#include <map>
+
+using namespace std;
+
+//Single logged search detection or track event
+struct compareRecord {
+   char kind;        //'D' = search detection. 'T' = track event
+   int type;         //trackEventType of track event
+   int faceIter;     //Radar face of detection
+   int sectorIter;   //Search sector of detection
+   int targetID;     //Truth target
+   double time;      //Search beam time, or track event time. (seconds)
+   double snr;       //Received SNR of detection. (decible)
+   double az;        //Search beam, or next track beam azimuth position. (degrees)
+   double el;        //Search beam, or next track beam elevation position. (degrees)
+};
+
+//Writes search detections to log
+void logDetection(const searchDetectRecord &record, void* userData){
+   fprintf((FILE*)userData, "D %d %d %d %.17g %.17g %.17g %.17g\n", record.faceIter, record.sectorIter, (record.detectedTarget != NULL) ? record.detectedTarget->getTargetID() : -1,
+           record.dwellTime, record.snr, record.azPos, record.elPos);
+}
+
+//Writes track events to log
+void logTrackEvent(const trackEventRecord &record, void* userData){
+   fprintf((FILE*)userData, "T %d %d %.17g %.17g %.17g\n", (int)record.type, record.trackedTarget->getTargetID(),
+           record.time, record.nextScanAz, record.nextScanEl);
+}
+
+//Runs inputFiles scenario and logs every record
+int runScenario(const char* logName, bool decoupled){
+   FILE* log = fopen(logName, "w");
+   if(log == NULL){
+      cout << "Error, could not open " << logName << endl;
+      return 1;
+   }
+   srand(1);   //Fixed starting scan positions, same in both builds
+   configManager config;
+   config.inputRadarFile("inputFiles/RadarInfo.txt");
+   config.inputFaceFile("inputFiles/FaceInfo.txt");
+   config.inputSectorFile("inputFiles/SectorInfo.txt");
+   config.inputTargetFile("inputFiles/TargetInfo.txt");
+
+   radar simRadar;
+   config.initializeInputData(simRadar);
+   simRadar.setConsoleOutput(false);
+   simRadar.setStoreSearchHistory(false);
+   simRadar.setDecoupledTimeline(decoupled);
+   simRadar.setDetectionCallback(logDetection, log);
+   simRadar.setTrackEventCallback(logTrackEvent, log);
+   simRadar.startSimulation();
+   config.closeInputFiles();
+   fclose(log);
+
+   cout << "State precision: " << ((sizeof(stateReal) == sizeof(float)) ? "float" : "double") << endl;
+   cout << "sizeof(target) = " << sizeof(target) << " bytes, sizeof(tracker) = " << sizeof(tracker) << " bytes" << endl;
+   cout << "Wrote " << logName << endl;
+   return 0;
+}
+
+//Reads a log written by runScenario()
+bool readLog(const char* logName, vector<compareRecord> &records){
+   FILE* log = fopen(logName, "r");
+   if(log == NULL){
+      cout << "Error, could not open " << logName << endl;
+      return false;
+   }
+   char kind;
+   while(fscanf(log, " %c", &kind) == 1){
+      compareRecord record;
+      record.kind = kind;
+      record.type = 0;
+      record.faceIter = -1;
+      record.sectorIter = -1;
+      record.snr = 0;
+      int read = 0;
+      if(kind == 'D'){
+         read = fscanf(log, "%d %d %d %lf %lf %lf %lf", &record.faceIter, &record.sectorIter, &record.targetID, &record.time, &record.snr, &record.az, &record.el);
+         read = (read == 7);
+      }
+      else if(kind == 'T'){
+         read = fscanf(log, "%d %d %lf %lf %lf", &record.type, &record.targetID, &record.time, &record.az, &record.el);
+         read = (read == 5);
+      }
+      if(read == 0){
+         cout << "Error, malformed record in " << logName << endl;
+         fclose(log);
+         return false;
+      }
+      records.push_back(record);
+   }
+   fclose(log);
+   return true;
+}
+
+//Key records are matched by between logs
+string recordKey(const compareRecord &record){
+   char key[128];
+   snprintf(key, sizeof(key), "%c %d %d %d %d %.17g", record.kind, record.type, record.faceIter, record.sectorIter, record.targetID, record.time);
+   return key;
+}
+
+//Compares a reference (double) log against a test (float) log
+int compareLogs(const char* referenceName, const char* testName){
+   vector<compareRecord> reference;
+   vector<compareRecord> test;
+   if(readLog(referenceName, reference) == false || readLog(testName, test) == false){
+      return 1;
+   }
+
+   multimap<string, int> testIndex;
+   for(int recordIter = 0; recordIter < test.size(); recordIter++){
+      testIndex.insert(make_pair(recordKey(test[recordIter]), recordIter));
+   }
+
+   long matched[2] = {0, 0};        //0 = detections. 1 = track events
+   long referenceOnly[2] = {0, 0};
+   double maxSnrDiff = 0;
+   double sumSnrDiff = 0;
+   double maxAngleDiff[2] = {0, 0};
+   for(int recordIter = 0; recordIter < reference.size(); recordIter++){
+      const compareRecord &record = reference[recordIter];
+      int kindIter = (record.kind == 'D') ? 0 : 1;
+      multimap<string, int>::iterator found = testIndex.find(recordKey(record));
+      if(found == testIndex.end()){
+         referenceOnly[kindIter] = referenceOnly[kindIter] + 1;
+         continue;
+      }
+      const compareRecord &other = test[found->second];
+      testIndex.erase(found);
+      matched[kindIter] = matched[kindIter] + 1;
+      double angleDiff = max(fabs(record.az - other.az), fabs(record.el - other.el));
+      maxAngleDiff[kindIter] = max(maxAngleDiff[kindIter], angleDiff);
+      if(kindIter == 0){
+         maxSnrDiff = max(maxSnrDiff, fabs(record.snr - other.snr));
+         sumSnrDiff = sumSnrDiff + fabs(record.snr - other.snr);
+      }
+   }
+   long testOnly[2] = {0, 0};
+   for(multimap<string, int>::iterator iter = testIndex.begin(); iter != testIndex.end(); ++iter){
+      testOnly[(test[iter->second].kind == 'D') ? 0 : 1]++;
+   }
+
+   const char* names[2] = {"Search detections", "Track events"};
+   for(int kindIter = 0; kindIter < 2; kindIter++){
+      cout << names[kindIter] << ": " << matched[kindIter] << " matched, " << referenceOnly[kindIter] << " only in " << referenceName
+           << ", " << testOnly[kindIter] << " only in " << testName << endl;
+   }
+   cout << "Largest search detection SNR difference= (" << maxSnrDiff << ")dB, mean= (" << ((matched[0] > 0) ? sumSnrDiff/matched[0] : 0) << ")dB" << endl;
+   cout << "Largest search beam position difference= (" << maxAngleDiff[0] << ")degree" << endl;
+   cout << "Largest next track beam position difference= (" << maxAngleDiff[1] << ")degree" << endl;
+   return 0;
+}
+
+int main(int argc, char** argv){
+   if(argc >= 3 && string(argv[1]) == "run"){
+      bool decoupled = (argc >= 4 && string(argv[3]) == "decoupled");
+      return runScenario(argv[2], decoupled);
+   }
+   if(argc == 4 && string(argv[1]) == "compare"){
+      return compareLogs(argv[2], argv[3]);
+   }
+   cout << "Usage: " << argv[0] << " run <log> [decoupled]" << endl;
+   cout << "       " << argv[0] << " compare <double log> <float log>" << endl;
+   return 1;
+}
@@ -1,17 +1,56 @@
 /*//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
  * Unclassified
  * Coder: Weston Yohe
- * Last Modified: 8/11/2022
+ * Last Modified: 10/19/2026
  * Description: radar.h contains the physical properties/characteristics and fucntionality (search,detect,track) of the radar system being simulated.
  *              radar.h also contains the function, StartSim(), which starts the simulation. Once StartSim() is called, radar.h uses all simulation files
  *              to gather the data/information needed to run the simulation. Thus, radar.h acts as a hub for simulation data.
+ *              Optionally, the simulation can be paced against the wall clock (real-time mode) using realTimePacer.h.
+ *              A radar is located at a radar site (radarSite.h) and views targets through site relative coordinates computed on the fly,
+ *              so several radars can observe one shared, read-only target table as a radar network (radarNetwork.h).
+ *              With a decoupled beam timeline the outcome for a target no longer depends on other targets, which lets the target table
+ *              be split across worker processes (shardedSimulation.h).
+ *              Optionally, search detections of each frame/face are merged into plots (plotExtractor.h) that tracks are started from, and tracks can be maintained from
+ *              noisy measurements associated to tracks instead of from the truth target each track was started on (trackAssociation.h).
+ *              Search beams only test the targets scheduled on them by the face's illumination schedule (illuminationSchedule.h).
+ *              Track profiles live in a track pool (trackPool.h) that drops lost tracks from service and recycles their trackers.
+ *              Search and track beams can lose gain off beam center and when steered off a face's boresight (antennaPattern.h).
+ *              Search sectors with a probability of false alarm add false alarms to their search beams (falseAlarms.h).
+ *              Derived face/sector quantities and link budget constants are read from a compiled, read-only simulation plan
+ *              (simulationPlan.h), built by configManager or at the start of the simulation. Search beams step through the plan's face
+ *              and sector tables by index, each face keeping the position of the sector its next search beam is sent in.
+ *              Optionally, search beams and detections are accumulated into per-face coverage heatmaps during the run (coverageMap.h).
+ *              Search beams, detections and track events can be published live to other local processes (telemetryFeed.h).
+ *              Optionally, startSimulation() runs pipelined: per frame culling/scheduling builds and record output run on their own
+ *              threads, ahead of and behind the radar's search and track beams (simulationPipeline.h).
+ *              Builds with -DRADARSIM_PERF_COUNTERS collect hardware performance counters per simulation phase (perfCounters.h).
  */////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifndef RADAR_H
 #define RADAR_H
 #include "radarFace.h"
 #include "target.h"
 #include "tracker.h"
+#include "trackPool.h"
 #include "utility.h"
+#include "realTimePacer.h"
+#include "simulationRecords.h"
+#include "rangeCulling.h"
+#include "illuminationSchedule.h"
+#include "detectionModel.h"
+#include "antennaPattern.h"
+#include "counterRNG.h"
+#include "radarSite.h"
+#include "plotExtractor.h"
+#include "trackAssociation.h"
+#include "falseAlarms.h"
+#include "perfCounters.h"
+#include "simulationPlan.h"
+#include "coverageMap.h"
+#include "telemetryFeed.h"
+#include "simulationPipeline.h"
+#include <sstream>
+#include <mutex>
+#include <thread>
 
 using namespace std;
 
@@ -19,6 +58,39 @@ class radar {
    public:
       radar(){
          time = 0;                  //initializing simulation run time 
+         dwellStartTime = 0;        //initializing current search beam time
+         storeSearchHistory = true; //search detections are stored for searchDataOutput by default
+         consoleOutput = true;      //track updates and simulation summary are printed to console by default
+         rangeCulling = true;       //targets out of a sector's detectable range are skipped by default
+         illuminationScheduling = true; //search beams skip targets outside their beam during the interval frame by default
+         searchRangesDirty = true;  //sector link budgets/detectable ranges are initialized before first frame
+         nextTargetID = 0;          //initializing target ID counter
+         targetTable = &targetVector; //radar observes its own targets unless it is a network site
+         sharedTargets = false;
+         dwellCount = 0;            //initializing search beam counter
+         trackBeamCount = 0;        //initializing track beam counter
+         frameCount = 0;            //initializing simulation frame counter
+         currentFaceIter = -1;      //no radar face searching before first frame
+         currentSectorIter = -1;
+         decoupledTimeline = false; //track/confirmation beams take time from search beams by default
+         detectCallback = NULL;     //no record callbacks/buffers by default
+         detectUserData = NULL;
+         trackCallback = NULL;
+         trackUserData = NULL;
+         plotExtraction = false;    //search detections are not merged into plots by default
+         measurementAssociation = false; //tracks follow the truth target they were started on by default
+         measurementNoise = 30; //30 meter (1 sigma per axis) measurement noise with measurement association
+         falseAlarmGeneration = true; //sectors with a probability of false alarm generate false alarms by default
+         falseAlarmCount = 0;       //initializing false alarm counter
+         plotCallbackFunction = NULL;
+         plotUserData = NULL;
+         coverage = NULL;           //no coverage heatmaps by default
+         telemetry = NULL;          //no live telemetry by default
+         pipelinedExecution = false; //simulation runs on a single thread by default
+         outputRunning = false;
+         nextTruthTime = 0;
+         setDetectionBuffer(NULL, 0);
+         setTrackEventBuffer(NULL, 0);
          possibleDetections = 0;    //initializing search detection counter
          confirmedDetections = 0;   //initializing track profile counter
       } 
@@ -31,25 +103,188 @@ class radar {
          faceVector.push_back(&face);
       }
 
-      //Returns vector containing all radar face objects
-      vector<radarFace*> getRadarFaceVector(){
+      //Sets compiled simulation plan of radar's faces and search sectors (see simulationPlan.h), shared and read-only.
+      //Without a plan, or if faces/sectors are changed after it is set, one is compiled at the start of the simulation
+      void setSimulationPlan(shared_ptr<const simulationPlan> compiledPlan){
+         if(compiledPlan != NULL && compiledPlan->matches(faceVector) == false){
+            cout << "Error, simulation plan does not match radar's faces and search sectors" << endl;
+            exit(1);
+         }
+         plan = compiledPlan;
+         if(plan != NULL){
+            bindSectorTable();
+         }
+         searchRangesDirty = true; //Sector link budgets are taken from plan
+      }
+
+      //Gets compiled simulation plan, NULL before it is compiled
+      shared_ptr<const simulationPlan> getSimulationPlan(){
+         return plan;
+      }
+
+      //Function compiles simulation plan from radar's current faces and search sectors
+      void compileSimulationPlan(){
+         setSimulationPlan(make_shared<simulationPlan>(faceVector));
+      }
+
+      //Function flattens faces' search sectors into sectorTable in plan order, so search beams reach sectors by plan index. Faces keep
+      //the sector their next search beam is sent in, faces new to the radar start with their first sector
+      void bindSectorTable(){
+         sectorTable.clear();
+         for(int faceIter = 0; faceIter < faceVector.size(); faceIter++){
+            const vector<searchSector*> &sectorVector = faceVector[faceIter]->getSearchSectorVector();
+            sectorTable.insert(sectorTable.end(), sectorVector.begin(), sectorVector.end());
+         }
+         nextSector.resize(plan->getFaceCount(), 0);
+         for(int faceIter = 0; faceIter < plan->getFaceCount(); faceIter++){
+            if(nextSector[faceIter] >= plan->getFace(faceIter).sectorCount){
+               nextSector[faceIter] = 0;
+            }
+         }
+      }
+
+      //Returns vector containing all radar face objects (no copy, valid while radar exists)
+      const vector<radarFace*>& getRadarFaceVector(){
          return faceVector;
       }
 
       //Adds target objects to targetVector, storing all target objects
       void addTarget(target &radarTarget){
+         if(sharedTargets == true){
+            cout << "Error, targets of a radar network site are added through radarNetwork" << endl;
+            exit(1);
+         }
+         radarTarget.setTargetID(nextTargetID); //Unique ID, used to key random draws for target
+         nextTargetID = nextTargetID + 1;
          targetVector.push_back(&radarTarget);
+         searchRangesDirty = true; //Largest RCS present may have changed
+      }
+
+      //Returns target table radar observes (own targetVector, or network's shared target table). No copy, changes when targets are added/removed
+      const vector<target*>& getTargetVector(){
+         return *targetTable;
+      }
+
+      //Removes target object from target table along with any tracking profile of the target. Must be called between frames.
+      //Target object itself is not deleted, it is still owned by the caller
+      void removeTarget(target* radarTarget){
+         if(sharedTargets == true){
+            cout << "Error, targets of a radar network site are removed through radarNetwork" << endl;
+            exit(1);
+         }
+         removeTracks(radarTarget);
+         for(int targetIter = 0; targetIter < targetVector.size(); targetIter++){
+            if(targetVector[targetIter] == radarTarget){
+               targetVector.erase(targetVector.begin() + targetIter);
+               return;
+            }
+         }
+      }
+
+      //Removes (drops) every tracking profile of a target. Must be called between frames
+      void removeTracks(target* radarTarget){
+         const vector<tracker*> &liveTracks = tracks.getActive();
+         for(int trackIter = 0; trackIter < liveTracks.size(); trackIter++){
+            if(liveTracks[trackIter]->getTarget() == radarTarget){
+               tracks.drop(liveTracks[trackIter]);
+            }
+         }
+         const vector<tracker*> &parkedTracks = tracks.getParked();
+         for(int trackIter = 0; trackIter < parkedTracks.size(); trackIter++){
+            if(parkedTracks[trackIter]->getTarget() == radarTarget){
+               tracks.drop(parkedTracks[trackIter]);
+            }
+         }
+         tracks.compact();
+      }
+
+      //Sets track coast rules (see trackPool.h): a confirmed track whose track beam misses coasts, its prediction carried to the next track beam,
+      //until more than beams consecutive track beams missed or coastTime passed since its last detection, then it is lost and dropped. Unconfirmed
+      //tracks are dropped. By default a track is lost on its first miss and is parked, without track beams, until a search detection re-confirms it
+      //Units: seconds
+      void setTrackCoasting(int beams, double coastTime = HUGE_VAL){
+         tracks.setCoastRules(beams, coastTime);
+      }
+
+      //Sets amount of live tracks storage is allocated for ahead of time: track profiles, track lists and the per-scan storage of track beams
+      //and measurement association, so a steady state simulation with up to trackCount live tracks does not allocate. Targets are added first
+      void reserveTracks(int trackCount){
+         tracks.reserve(trackCount);
+         associator.reserve(trackCount);
+         beamGrid.reserve(targetTable->size()); //Every active target is placed in track beam grid
+         beamCandidates.reserve(trackCount);
+         measurements.reserve(trackCount);
+         measurementPoints.reserve(trackCount);
+         measuredAt.reserve(targetTable->size());
+         trackPoints.reserve(trackCount);
+         trackAssignment.reserve(trackCount);
+      }
+
+      //Gets amount of live (not dropped) tracks, parked inactive tracks included
+      int getLiveTrackCount(){
+         tracks.compact();
+         return tracks.getActive().size() + tracks.getParked().size();
+      }
+
+      //Gets track pool, e.g. to read amount of allocated/recycled trackers
+      trackPool& getTrackPool(){
+         return tracks;
+      }
+
+      //Sets target table radar observes instead of its own targetVector. Used by radarNetwork so every site shares one table.
+      //Targets in the table are only read by the radar
+      void setTargetTable(vector<target*>* table){
+         targetVector.clear(); //Radar's own targets are expected to have been handed to the shared table
+         targetTable = table;
+         sharedTargets = true;
+         searchRangesDirty = true;
       }
 
-      //Returns targetVector, containing all target objects
-      vector<target*> getTargetVector(){
-         return targetVector;
+      //Notifies radar that targets were added to its shared target table (sector detectable ranges depend on largest RCS)
+      void markTargetsChanged(){
+         searchRangesDirty = true;
+      }
+
+      //Sets radar site position in world frame
+      void setSitePosition(lengthValue x, lengthValue y, lengthValue z){
+         site.setPosition(x, y, z);
+      }
+
+      //Sets radar site heading, world azimuth the radar's 0 degree azimuth points along
+      void setSiteHeading(angleValue heading){
+         site.setHeading(heading);
+      }
+
+      //Gets radar site, used to convert between world and site relative coordinates
+      radarSite& getSite(){
+         return site;
+      }
+
+      //Sets name printed in front of radar's console output, used to tell radar network sites apart
+      void setSiteName(string name){
+         siteName = name;
+      }
+
+      //Gets name printed in front of radar's console output
+      string getSiteName(){
+         return siteName;
+      }
+
+      //Gets current simulation time
+      //Unit: seconds
+      double getTime(){
+         return time;
+      }
+
+      //Sets current simulation time, e.g. to the time worker processes finished at (shardedSimulation.h)
+      //Unit: seconds
+      void setTime(double seconds){
+         time = seconds;
       }
 
       //Sets length of simulated time simulation will run
-      //Units: Minutes
-      void setSimLength(double time){
-         simLength = 60*time; //Converted from minutes to seconds
+      void setSimLength(timeValue length){
+         simLength = length / units::s;
       }
 
       //Returns length of simulated time simulation will run
@@ -59,9 +294,8 @@ class radar {
       }
 
       //Sets Tracker PRF
-      //Units: Gigahertz
-       void setTrackPRF(double kiloHertz){
-        trackPRF = utility::kiloToBase(kiloHertz);
+      void setTrackPRF(frequencyValue prf){
+         trackPRF = prf / units::Hz;
       }
 
       //Returns tracker prf
@@ -70,9 +304,8 @@ class radar {
          return trackPRF;
       }
       //Sets minimum SNR needed for tracker detection
-      //Units:  decible
-      void setTrackingSNRmin(double snr){
-         trackingSNRmin = snr;
+      void setTrackingSNRmin(decibelValue snr){
+         trackingSNRmin = snr / units::dB;
       }
 
       //Gets minimum SNR needed for tracker detection
@@ -98,8 +331,8 @@ class radar {
       }
 
       //Sets refreshRate of simulated time frames/intervals
-      void setRefreshRate(double seconds){
-         refreshRate = seconds;
+      void setRefreshRate(timeValue rate){
+         refreshRate = rate / units::s;
       }
 
       //Gets refreshRate of simulated time frames/intervals
@@ -123,59 +356,311 @@ class radar {
          return trackBeamWidth[iter];
       }
 
+      //Enables real-time mode, pacing simulated time against the wall clock. Detections and track updates are emitted to the
+      //console (or stream set through getRealTimePacer()) once the wall clock reaches their simulated time.
+      //Input: speedFactor = simulated seconds per wall clock second (1 = real-time)
+      void setRealTimeMode(double speedFactor){
+         pacer.enable(speedFactor);
+      }
+
+      //Gets real-time pacer, used to set real-time output stream/lag tolerance and read real-time metrics
+      realTimePacer& getRealTimePacer(){
+         return pacer;
+      }
+
+      //Sets bool determining if search detections are stored in radar's detection vectors (used by searchDataOutput). Turning storage
+      //off keeps memory constant when detections are consumed through callbacks/buffers instead
+      void setStoreSearchHistory(bool logic){
+         storeSearchHistory = logic;
+      }
+
+      //Sets amount of search detections (and plots) stored detection vectors are allocated for ahead of time, so storing search history
+      //does not allocate until detections amount is passed
+      void reserveSearchHistory(size_t detections){
+         searchDetecFaceIterVector.reserve(detections);
+         searchDetecSectorIterVector.reserve(detections);
+         searchDetecTimeVector.reserve(detections);
+         searchDetectSnrVector.reserve(detections);
+         searchDetecAzPosVector.reserve(detections);
+         searchDetecElPosVector.reserve(detections);
+         if(plotExtraction == true){
+            plotVector.reserve(detections);
+         }
+      }
+
+      //Sets detection model used by search and track beams (see detectionModel.h). SNR_THRESHOLD keeps hard SNR thresholds,
+      //Swerling cases draw detections from probability of detection computed from received SNR and Pfa
+      void setDetectionModel(swerlingCase swerling, double pfa){
+         detection.setModel(swerling, pfa);
+         searchRangesDirty = true; //Culling range depends on detection model
+      }
+
+      //Sets antenna pattern of search/track beams and cos^n(theta) scan loss exponent (see antennaPattern.h). By default beams have full gain
+      //anywhere inside their beamwidth (PATTERN_RECTANGULAR, exponent 0)
+      void setAntennaPattern(antennaPatternShape shape, double scanLossExponent){
+         antenna.configure(shape, scanLossExponent);
+      }
+
+      //Gets detection model, used to read Pd/Pfa or set culling Pd
+      detectionModel& getDetectionModel(){
+         return detection;
+      }
+
+      //Sets seed of random draws used by probabilistic detection
+      void setRandomSeed(uint64_t seed){
+         rng.setSeed(seed);
+      }
+
+      //Sets bool determining if search beams skip targets outside a sector's detectable range (see rangeCulling.h).
+      //Culling is conservative, simulation results are the same with culling on or off
+      void setRangeCulling(bool logic){
+         rangeCulling = logic;
+      }
+
+      //Sets bool determining if search beams only test targets their beam could illuminate during the interval frame (see illuminationSchedule.h).
+      //Scheduling is conservative, simulation results are the same with scheduling on or off
+      void setIlluminationScheduling(bool logic){
+         illuminationScheduling = logic;
+      }
+
+      //Sets bool determining if track and confirmation beams are scheduled outside of the search timeline. By default every track beam delays the
+      //rest of the frame and track beam draws are keyed by track beam count, so one target's detections shift the beams seen by every other target.
+      //With a decoupled timeline track/confirmation beams take no search time and their draws are keyed by frame/search beam number, tracks are
+      //serviced in target ID order, and each target's detections depend only on the target itself
+      void setDecoupledTimeline(bool logic){
+         decoupledTimeline = logic;
+      }
+
+      //Gets bool determining if track and confirmation beams are scheduled outside of the search timeline
+      bool getDecoupledTimeline(){
+         return decoupledTimeline;
+      }
+
+      //Sets bool determining if startSimulation() runs pipelined (see simulationPipeline.h): range cull index/illumination bounds of upcoming frames
+      //are built on a truth stage thread and records are emitted on an output stage thread, while search and track beams run on the calling thread. Detections, tracks
+      //and record order are the same as a single thread run. Callbacks are called from the output stage thread, and a track event's track profile
+      //keeps changing while the record waits in queue (record's track identifies the track only). Frames run by calling stepFrame() are not pipelined.
+      //Per beam target views and track updates stay on the calling thread, so only use with spare cores (see limits in simulationPipeline.h)
+      void setPipelinedExecution(bool logic){
+         pipelinedExecution = logic;
+      }
+
+      //Gets bool determining if startSimulation() runs pipelined
+      bool getPipelinedExecution(){
+         return pipelinedExecution;
+      }
+
+      //Gets truth stage of pipelined simulation, used to read how many truth frames were used/dropped
+      truthStage& getTruthStage(){
+         return truth;
+      }
+
+      //Sets bool determining if track updates and simulation start/summary messages are printed to console
+      void setConsoleOutput(bool logic){
+         consoleOutput = logic;
+      }
+
+      //Sets function called on every search detection. Record is only valid during the call
+      void setDetectionCallback(searchDetectCallback callback, void* userData){
+         detectCallback = callback;
+         detectUserData = userData;
+      }
+
+      //Sets function called on every track event (started, updated, lost). Record is only valid during the call
+      void setTrackEventCallback(trackEventCallback callback, void* userData){
+         trackCallback = callback;
+         trackUserData = userData;
+      }
+
+      //Sets bool determining if tracks are maintained by measurement-to-track association (see trackAssociation.h). Track beams then measure every
+      //target inside them with noise, measurements are assigned to tracks within validation gates (global nearest neighbor), tracks without a
+      //measurement are lost and removed, and search detections inside an existing track's gate do not start new tracks
+      void setMeasurementAssociation(bool logic){
+         measurementAssociation = logic;
+      }
+
+      //Gets bool determining if tracks are maintained by measurement-to-track association
+      bool getMeasurementAssociation(){
+         return measurementAssociation;
+      }
+
+      //Sets standard deviation of measurement noise (each cartesian axis) used with measurement association
+      void setMeasurementNoise(lengthValue noise){
+         measurementNoise = noise / units::m;
+      }
+
+      //Sets validation gate used with measurement association, largest distance between a track's predicted position and its measurement
+      void setAssociationGate(lengthValue gate){
+         associator.setGate(gate / units::m);
+      }
+
+      //Sets bool determining if search sectors with a probability of false alarm generate false alarms (see falseAlarms.h). Used by
+      //shardedSimulation.h so false alarms, which do not depend on targets, are generated by one worker process only
+      void setFalseAlarmGeneration(bool logic){
+         falseAlarmGeneration = logic;
+      }
+
+      //Sets bool determining if search detections of each frame/face are merged into plots (see plotExtractor.h). Plots are handed to
+      //plot callback and stored for searchDataOutput/plotDataOutput. Tracks are then started from plots: once a face's search beams of
+      //the frame are sent, a confirmation beam is sent to each plot's centroid instead of to every search detection
+      void setPlotExtraction(bool logic){
+         plotExtraction = logic;
+      }
+
+      //Gets bool determining if search detections are merged into plots
+      bool getPlotExtraction(){
+         return plotExtraction;
+      }
+
+      //Sets bounds of a single plot (see plotExtractor.h): hits are not merged across more than beams beamwidths in azimuth/elevation
+      //or across search beams sent more than seconds apart. Default is 3 beamwidths within 0.5 seconds
+      void setPlotClusterLimits(double seconds, int beams){
+         plots.setClusterLimits(seconds, beams);
+      }
+
+      //Sets function called on every extracted plot. Record is only valid during the call
+      void setPlotCallback(plotCallback callback, void* userData){
+         plotCallbackFunction = callback;
+         plotUserData = userData;
+      }
+
+      //Sets caller-owned coverage map search beams and detections are accumulated into (see coverageMap.h). The radar accumulates
+      //into its own tables during the simulation and merges them into the map when the simulation ends. NULL = no coverage maps.
+      //May be set between frames of a simulation run frame by frame: coverage accumulated so far is merged into the previous map,
+      //and the radar's tables are sized for the new map's grid and every face
+      void setCoverageMap(coverageMap* map){
+         if(coverage != NULL && coverageLocal.getFaceCount() > 0){
+            coverage->merge(coverageLocal);
+         }
+         coverage = map;
+         if(coverage != NULL){
+            coverage->reserveFaces(faceVector.size());
+            coverageLocal.configureLike(*coverage, faceVector.size());
+         }
+      }
+
+      //Gets caller-owned coverage map, NULL if none
+      coverageMap* getCoverageMap(){
+         return coverage;
+      }
+
+      //Gets coverage accumulated by radar since simulation began, not yet merged into coverage map. Used by shardedSimulation.h
+      coverageMap& getCoverageAccumulator(){
+         return coverageLocal;
+      }
+
+      //Sets caller-owned telemetry feed search beams, detections and track events are published to (see telemetryFeed.h).
+      //A feed has a single producer, every radar network site needs its own feed. NULL = no telemetry
+      void setTelemetryFeed(telemetryFeed* feed){
+         telemetry = feed;
+      }
+
+      //Sets caller-owned buffer search detections are written directly into. Detections beyond capacity are counted as overflow.
+      //Buffer is emptied by resetDetectionBuffer()
+      void setDetectionBuffer(searchDetectRecord* buffer, int capacity){
+         detectBuffer = buffer;
+         detectBufferCapacity = capacity;
+         resetDetectionBuffer();
+      }
+
+      //Sets caller-owned buffer track events are written directly into. Events beyond capacity are counted as overflow.
+      //Buffer is emptied by resetTrackEventBuffer()
+      void setTrackEventBuffer(trackEventRecord* buffer, int capacity){
+         trackBuffer = buffer;
+         trackBufferCapacity = capacity;
+         resetTrackEventBuffer();
+      }
+
+      //Empties caller-owned detection buffer (does not free it)
+      void resetDetectionBuffer(){
+         detectBufferCount = 0;
+         detectBufferOverflow = 0;
+      }
+
+      //Empties caller-owned track event buffer (does not free it)
+      void resetTrackEventBuffer(){
+         trackBufferCount = 0;
+         trackBufferOverflow = 0;
+      }
+
+      //Gets amount of detections written into caller-owned buffer since last reset
+      int getDetectionBufferCount(){
+         return detectBufferCount;
+      }
+
+      //Gets amount of track events written into caller-owned buffer since last reset
+      int getTrackEventBufferCount(){
+         return trackBufferCount;
+      }
+
+      //Gets amount of detections that did not fit in caller-owned buffer since last reset
+      long getDetectionBufferOverflow(){
+         return detectBufferOverflow;
+      }
+
+      //Gets amount of track events that did not fit in caller-owned buffer since last reset
+      long getTrackEventBufferOverflow(){
+         return trackBufferOverflow;
+      }
+
+      //Gets amount of search beams sent so far
+      uint64_t getDwellCount(){
+         return dwellCount;
+      }
+
+      //Gets amount of simulation frames run so far
+      uint64_t getFrameCount(){
+         return frameCount;
+      }
+
 //////Getters below are for configurationManager which is used to display all search detection data to user in specified .txt file
+//////Vectors are returned without a copy and keep growing while the simulation runs
 
       //Gets vector with all search detection times
-      vector<double> getSearchDetectTimeVector(){
+      const vector<double>& getSearchDetectTimeVector(){
          return searchDetecTimeVector;
       }
       //Gets vector with all search detection snr values
-      vector<double> getSearchDetectSnrVector(){
+      const vector<double>& getSearchDetectSnrVector(){
          return searchDetectSnrVector;
       }
       //Gets vector with all search detection azimuth scan positions
-      vector<double> getSearchDetectAzPosVector(){
+      const vector<double>& getSearchDetectAzPosVector(){
          return searchDetecAzPosVector;
       }
       //Gets vector with all search detection elevation scan positions
-      vector<double> getSearchDetectElPosVector(){
+      const vector<double>& getSearchDetectElPosVector(){
          return searchDetecElPosVector;
       }
       //Gets vector storing radar faces that made search detections
-      vector<int> getSearchDetectFaceIterVector(){
+      const vector<int>& getSearchDetectFaceIterVector(){
          return searchDetecFaceIterVector;
       }
       //Gets vector storing search sectors that made search detections
-      vector<int> getSearchDetectSectorIterVector(){
+      const vector<int>& getSearchDetectSectorIterVector(){
          return searchDetecSectorIterVector;
       }
+      //Gets vector with all extracted plots
+      const vector<plotRecord>& getPlotVector(){
+         return plotVector;
+      }
 
-      //Adds/sets a new tracking profiles to trackVector. Inputs target to track, time of detection, current azimuth and elevation scanning positions
-      void addTrack(target* detectedTarget, double detectedTime, double azScan, double elScan){         
-            tracker* detection = new tracker(detectedTarget,detectedTime,A_B_gammaWeights,azScan,elScan);
-            trackVector.push_back(detection);
+      //Adds/sets a new tentative tracking profile to the track pool. Inputs target to track, time of detection, current azimuth and elevation scanning positions,
+      //and site relative cartesian position of detected target. Returns new tracking profile
+      tracker* addTrack(target* detectedTarget, double detectedTime, double azScan, double elScan, const double measuredXYZ[3]){         
+            //With a decoupled timeline tracks are kept in target ID order, so track beams are serviced in the same order however targets are split up
+            return tracks.acquire(detectedTarget, detectedTime, A_B_gammaWeights, azScan, elScan, measuredXYZ, decoupledTimeline);
       }
 
-      //Gets the current track profile of an inputted target
+      //Gets the live track profile of an inputted target
       tracker* getTrack(target *detectedTarget){
-         for(int trackIter = 0; trackIter < trackVector.size(); trackIter++){
-            if(trackVector[trackIter]->getTarget() == detectedTarget ){
-               tracker* track = trackVector[trackIter];
-               return track;
-            }
+         tracker* track = tracks.findLive(detectedTarget);
+         if(track == NULL){
+            exit(1);
          }
-         exit(1);
+         return track;
       }
 
-      //Gets the current numeric iterator value for a radar's face in the faceVector
-      int getFaceIter(radarFace* face){
-         for(int iter = 0; iter < faceVector.size(); iter++){
-            if(faceVector[iter] == face){
-               return iter;
-            }
-         }
-         exit(1);
-      }
 //////////////////////////////////////////////////////////////////////////////////////////////////
 
 
@@ -185,135 +670,273 @@ class radar {
                 begins. The function runs for a user-inputted amount
                 of time (simLength) and effectivley search, detects and tracks
                 targets using all the parameters inputted by the user .txt files.
+                Each simulation frame is run by stepFrame(), which can also be called
+                directly when the radar is embedded in another simulation (see radarSimulation.h).
  *//////////////////////////////////////////////////////////////////////////////
       void startSimulation(){
-         cout << "Starting simulation..." << endl << endl;
+         beginSimulation();
+         if(pipelinedExecution == true){
+            startPipeline(); //Truth and output stages start on their own threads
+         }
          
          //Loops over simulation length inputted by user. Effectively the length of active simulation
          while(time <= simLength){          
+            stepFrame();
+         }
+         stopPipeline(); //Waits for output stage to emit every record
+         endSimulation();
+      }
+
+      //Function prepares simulation to be run frame by frame. Called once before the first stepFrame()
+      void beginSimulation(){
+         //Faces or sectors reconfigured since the plan was built (or set) are compiled again, the old plan is left to its other holders
+         if(plan == NULL || plan->matches(faceVector) == false){
+            compileSimulationPlan();
+         }
+         if(coverage != NULL){
+            coverage->reserveFaces(faceVector.size());
+            coverageLocal.configureLike(*coverage, faceVector.size());
+         }
+         if(consoleOutput == true){
+            lock_guard<mutex> lock(consoleMutex());
+            cout << siteName << "Starting simulation..." << endl << endl;
+         }
+         if(pacer.isEnabled()){
+            pacer.start(time, refreshRate); //Anchoring simulated time to wall clock
+         }
+      }
+
+      //Function runs a single simulation frame (refreshRate seconds): services all tracks, searches over every radar face,
+      //then updates simulation time. Targets are only read, each target is viewed from radar's site at the time of each beam
+      void stepFrame(){
+         PERF_PHASE(PHASE_TRACK); //Frame time outside of faces' search is track servicing
+         if(plan == NULL){
+            compileSimulationPlan();
+         }
+         if(searchRangesDirty == true){
+            initializeSearchRanges();
+         }
+         if(antenna.isEnabled() == true && antenna.isBuiltFor(plan) == false){
+            antenna.build(plan); //Tabulating antenna losses of plan's faces
+         }
+         vector<target*> &targetVector = *targetTable; //Target table observed by radar
+         targetView view;                              //Site relative view of target at time of current beam
+         currentFaceIter = -1;                         //Track beams are not sent by a search face
+         currentSectorIter = -1;
+
+         //With measurement association, track beams measure every target inside them and tracks are assigned measurements
+         if(measurementAssociation == true){
+            serviceAssociatedTracks(targetVector);
+         }
+
+         //Loops through all active track profiles (inactive tracks are parked) to continue/update current track 
+         tracks.compact(); //Tracks dropped or lost during last frame's search leave service
+         const vector<tracker*> &liveTracks = tracks.getActive();
+         for(int detectIter = 0; detectIter < liveTracks.size() && measurementAssociation == false; detectIter++){ 
+            tracker* track = liveTracks[detectIter];
+            site.getView(track->getTarget(), time, view); //Viewing tracked target at time of track beam
             
-            //Loops through all track profiles to continue/update current track 
-            for(int detectIter = 0; detectIter < trackVector.size(); detectIter++){ 
-               
-               //If target is detected in estimated coordinates (calculated from tracker class),
-               //tracking profile is updated and simulation time is increased by tracking beam duration
-               if(trackDetection(trackVector[detectIter]) == true){ 
-                  trackVector[detectIter]->updateFilter(time);
-                  time = time + (1/trackPRF);
-               }
-               //If target is not detected in estimated coordinates, track profile will no longer update/refresh.
-               //User is notified
-               else{
-                  if(trackVector[detectIter]->getActivTrackBool() == true){
-                     trackVector[detectIter]->setActiveTrackBool(false);
-                     cout << "Lost track of target at: ";
-                     printCurrentPos_Time(trackVector[detectIter]->getTarget(), time);
-                  }
+            //If target is detected in estimated coordinates (calculated from tracker class),
+            //tracking profile is updated and simulation time is increased by tracking beam duration
+            if(trackDetection(track, view) == true){ 
+               track->updateFilter(time, view.xyz);
+               if(track->getActivTrackBool() == true){
+                  tracks.recordDetection(track); //Tentative tracks are only confirmed by a confirmation beam
                }
-               //updating all targets by tracking beam durations
-               for(int targetIter = 0; targetIter < targetVector.size(); targetIter++){
-                  targetVector[targetIter] ->updateCoordinatesXYZ(1/trackPRF);
+               emitTrackEvent(TRACK_UPDATED, track, time);
+               if(decoupledTimeline == false){
+                  time = time + (1/trackPRF);
                }
             }
+            //If target is not detected in estimated coordinates, track coasts or, once coast rules run out, is lost: parked inactive
+            //by default, dropped with track coasting. User is notified
+            else if(track->getActivTrackBool() == true && tracks.recordMiss(track, time) == true){
+               emitTrackMessage("Lost track of target at: ", track->getTarget(), time);
+               emitTrackEvent(TRACK_LOST, track, time);
+               tracks.lose(track);
+            }
+            else if(track->getState() == TRACK_COASTING){
+               track->coast(time + refreshRate); //Next track beam is at start of next frame
+            }
+         }
+         tracks.compact();
 
-            //Loop iterates over every radar face in same time interval/refrence. This effectively
-            //makes all faces simulatenous operate after refrence is over and overall simulation is updated by interval length
-            for(int faceIter = 0; faceIter < faceVector.size(); faceIter++){
+         //Pipelined execution, requesting upcoming frames' truth now that this frame's search start time is known
+         if(truth.isRunning() == true){
+            requestTruthFrames();
+         }
 
-               //Saving targets coordinates before entering interval frame for current radar face
-               for(int targetIter = 0; targetIter < targetVector.size(); targetIter++){ 
-                  targetVector[targetIter]->saveCurrentPOS();
-               }
-               
+         //Loop iterates over every radar face in same time interval/refrence. This effectively
+         //makes all faces simulatenous operate after refrence is over and overall simulation is updated by interval length
+         for(int faceIter = 0; faceIter < plan->getFaceCount(); faceIter++){
+            PERF_PHASE(PHASE_SEARCH);
+
+            const facePlan &faceEntry = plan->getFace(faceIter); //Compiled face being simulated
+            searchSector** faceSectors = &sectorTable[faceEntry.firstSector];             //Face's search sectors, consecutive in sector table
+            const sectorPlan* faceSectorPlans = &plan->getSectorTable()[faceEntry.firstSector]; //Compiled search sectors of face
+            currentFaceIter = faceIter;
+            double tempTime = time;                            //Temporary variable containing simulation time before entering interval frame
+            double intervalTime = 0;                           //Resetting/initializing interval/frame time
+            cullTargets(tempTime);                             //Gathering targets each sector could detect during interval frame
+            
+            //During loop, the current radar face searches over its search sectors "looking" for detections
+            while(intervalTime < refreshRate){ 
                
-               radarFace* face = faceVector[faceIter];            //Current radar face being simulated 
-               vector<searchSector*> sectorVector = faceVector[faceIter]->getSearchSectorVector(); //Vector containing radar face's search sectors
-               double tempTime = time;                            //Temporary variable containing simulation time before entering interval frame
-               double intervalTime = 0;                           //Resetting/initializing interval/frame time
+               //Setting the current sector which a search beam will be sent.
+               //Once one search beam is sent in sector, radar face will send next search beam
+               //in next search sector.
+               int sectorIter = nextSector[faceIter];
+               currentSectorIter = sectorIter;
+               searchSector* sector = faceSectors[sectorIter];
+               double dwellTime = faceSectorPlans[sectorIter].dwellTime;
                
-               //During loop, the current radar face searches over its search sectors "looking" for detections
-               while(intervalTime < refreshRate){ 
-                  
-                  //Setting the current sector which a search beam will be sent.
-                  //Once one search beam is sent in sector, radar face will send next search beam
-                  //in next search sector.
-                  searchSector* sector = sectorVector[face->getSectorVectorIter()];
-                  
-                  double additionalPri = 0; //Storing the additional time spent sending tracking/confirmation beams upon possible detection
-
-                  //Loop iterates through all simulated targets and tests if current search beam is within targets position
-                  //and within detection parameters, (e.g. snr value).
-                  for(int targetIter = 0; targetIter < targetVector.size(); targetIter++){
-       
-                     //If target is detected within current search beam, logic below determines if the
-                     //target already has a tracker profile or if detection is new. This is to avoid 
-                     //creating multiple tracking files, speeding simulation duration
-                     if(searchDetection(face,sector, targetVector[targetIter])==true){
-                        possibleDetections = possibleDetections + 1; //Adds to possbile detections counter
-      
-                       
-                        //If target already has a track profile but tracker lost track, make a new track profile
-                        if(targetRedetection(targetVector[targetIter]) == true){
-                           tracker* newTrack = getTrack(targetVector[targetIter]);
-                           confirmationScan(newTrack, tempTime);
-                           additionalPri = additionalPri + 1/trackPRF;
-                           //TO-DO: Instead of recreating new track, turn-on/update old track? 
-                        }
-                        //Logic below creates new track profile for detected target
-                        else{
-                           if(targetNewDetection(targetVector[targetIter])==false){
-                              addTrack(targetVector[targetIter],tempTime,sector->getScanPOS(0),sector->getScanPOS(1));
-                              tracker* newTrack = getTrack(targetVector[targetIter]);
-                              confirmationScan(newTrack, tempTime); //Confirmation beam sent to same location
-                              additionalPri = additionalPri + 1/trackPRF; //Update time by track beam duration
-                             
-                           }
-                        }
-                     }
-                     //Updating target position by search beam duration (DwellTime) and confirmation/track beam duration (1/trackPRF = PRI)
-                     targetVector[targetIter]->updateCoordinatesXYZ(sector->getDwellTime() + additionalPri); //update targetPOS from dwell
+               double additionalPri = 0; //Storing the additional time spent sending tracking/confirmation beams upon possible detection
+               dwellStartTime = tempTime; //Time current search beam is sent
+
+               //Confirmation beams pushed search past the culling/schedule window, targets are gathered again from current time
+               if((rangeCulling == true && cullIndex.isValidAt(tempTime) == false) || (illuminationScheduling == true && schedule.isValidAt(tempTime) == false)){
+                  cullTargets(tempTime);
+               }
+               vector<int> &sectorTargets = sectorCandidates[sectorIter];
+               const int* candidates = sectorTargets.data();  //Targets tested by search beam (targetVector positions)
+               int candidateCount = sectorTargets.size();
+               if(illuminationScheduling == true){
+                  candidateCount = schedule.getNextVisit(sectorIter, sectorTargets, candidates);
+                  schedule.advance(sectorIter);
+               }
+
+               //Probabilistic detection, one block of uniform draws for every candidate of search beam, keyed by beam number and target ID.
+               //Draws are independent per target, so skipped targets do not change the draws of tested ones
+               if(detection.isProbabilistic() == true){
+                  candidateIDs.resize(candidateCount);
+                  dwellDraws.resize(candidateCount);
+                  for(int candidateIter = 0; candidateIter < candidateCount; candidateIter++){
+                     candidateIDs[candidateIter] = targetVector[candidates[candidateIter]]->getTargetID();
                   }
+                  rng.fillUniform(dwellCount, candidateIDs.data(), candidateCount, dwellDraws.data());
+               }
 
-                  
-                  
-                  sector->incrementBeamPos(face->getHalfPowerBeamWidth(0),face->getHalfPowerBeamWidth(1)); //Positioning sector's scanning posiiton for next search beam
-                  //Updating tempTime and current interval time
-                  tempTime = tempTime + sector->getDwellTime() + additionalPri; //Update intime by dwell
-                  intervalTime = intervalTime + sector->getDwellTime()+  additionalPri; //Increment time by dwell
-                  face->incrementSectorVectorIter(); //Increment radar face search sector, for which the next search beam will be sent on
-                  
-                  //Logic below will be used for the small remaining intervalTime
-                  if(intervalTime >= refreshRate){
-                     double remainingDwell = intervalTime - refreshRate;
-                     //TO-DO: Create logic for remaining dwelltime/overflow
+               //Loop iterates through all simulated targets the search beam could illuminate and tests if current search beam is within targets position
+               //and within detection parameters, (e.g. snr value).
+               for(int candidateIter = 0; candidateIter < candidateCount; candidateIter++){
+                  int targetIter = candidates[candidateIter];
+                  //Viewing target at time of search beam. Targets outside their recorded time span cannot be detected
+                  if(targetVector[targetIter]->isActiveAt(tempTime) == false){
+                     continue;
                   }
+                  site.getView(targetVector[targetIter], tempTime, view);
+    
+                  //If target is detected within current search beam, logic below determines if the
+                  //target already has a tracker profile or if detection is new. This is to avoid 
+                  //creating multiple tracking files, speeding simulation duration
+                  double uniformDraw = (detection.isProbabilistic() == true) ? dwellDraws[candidateIter] : 0;
+                  if(searchDetection(faceEntry, sector, targetVector[targetIter], view, uniformDraw)==true){
 
+                     //With plot extraction, tracks are started from the face's plots once its search beams of the frame are sent
+                     if(plotExtraction == true){
+                        continue;
+                     }
+   
+                     //With measurement association, a new track is started unless detection falls inside an existing track's gate
+                     if(measurementAssociation == true){
+                        if(initiateAssociatedTrack(targetVector[targetIter], tempTime, sector->getScanPOS(0), sector->getScanPOS(1), view) == true){
+                           additionalPri = additionalPri + 1/trackPRF; //Confirmation beam sent
+                        }
+                        continue;
+                     }
+                    
+                     //If target already has a track profile but tracker lost track, old (parked) track profile is sent a confirmation beam
+                     //(with track coasting lost tracks were dropped, so a target that lost track gets a new track profile)
+                     tracker* existingTrack = tracks.findLive(targetVector[targetIter]);
+                     if(existingTrack != NULL && existingTrack->getActivTrackBool() == false){
+                        confirmationScan(existingTrack, tempTime, view);
+                        additionalPri = additionalPri + 1/trackPRF;
+                     }
+                     //Logic below creates new track profile for detected target
+                     else if(existingTrack == NULL){
+                        tracker* newTrack = addTrack(targetVector[targetIter],tempTime,sector->getScanPOS(0),sector->getScanPOS(1),view.xyz);
+                        confirmationScan(newTrack, tempTime, view); //Confirmation beam sent to same location
+                        additionalPri = additionalPri + 1/trackPRF; //Update time by track beam duration
+                     }
+                  }
+               }
 
+               //False alarms of search beam, each is sent a confirmation beam like a target detection
+               if(falseAlarmGeneration == true && sector->getFalseAlarmPfa() > 0){
+                  additionalPri = additionalPri + searchFalseAlarms(faceEntry, sector);
                }
-               //Resetting target position back to position before interval frame
-               for(int targetIter = 0; targetIter < targetVector.size(); targetIter++){  
-                  targetVector[targetIter]->resetToSavedPOS();
+               
+               if(coverage != NULL || telemetry != NULL){
+                  emitBeam(faceIter, sectorIter, sector); //Counting search beam in coverage heatmap/publishing it
+               }
+               sector->incrementBeamPos(faceEntry.halfPowerBeamWidth[0],faceEntry.halfPowerBeamWidth[1]); //Positioning sector's scanning posiiton for next search beam
+               if(decoupledTimeline == true){
+                  additionalPri = 0; //Confirmation beams are scheduled outside of the search timeline
                }
+               //Updating tempTime and current interval time
+               tempTime = tempTime + dwellTime + additionalPri; //Update intime by dwell
+               intervalTime = intervalTime + dwellTime +  additionalPri; //Increment time by dwell
+               nextSector[faceIter] = (sectorIter + 1 == faceEntry.sectorCount) ? 0 : sectorIter + 1; //Face's next search beam is sent in its next sector
+               dwellCount = dwellCount + 1;
                
+               //Logic below will be used for the small remaining intervalTime
+               if(intervalTime >= refreshRate){
+                  double remainingDwell = intervalTime - refreshRate;
+                  //TO-DO: Create logic for remaining dwelltime/overflow
+               }
+
+
             }
-            
-            //Updating target coordinates to position after interval frame
-            for(int targetIter = 0; targetIter < targetVector.size(); targetIter++){ 
-               targetVector[targetIter]->updateCoordinatesXYZ(refreshRate);
+            //Face's hits of frame are complete
+            if(plotExtraction == true){
+               plots.flush(pendingPlots);
+               startPlotTracks(tempTime, view);
+               emitPlots();
             }
-            
-            time = time + refreshRate; //Updating overall simulaton time from time spent in interval refrence
+         }
+         
+         //Real-time mode, releases frame's detections and track updates once the wall clock reaches them
+         if(pacer.isEnabled()){
+            emitFrame(time);
+         }
 
-            //Logic will be used for simulation time overflow
-            if(time >= simLength){
-            //TO-DO:Create logic for remaining simulation time
-            }
-            
+         time = time + refreshRate; //Updating overall simulaton time from time spent in interval refrence
+         frameCount = frameCount + 1;
+
+         //Logic will be used for simulation time overflow
+         if(time >= simLength){
+         //TO-DO:Create logic for remaining simulation time
+         }
+         
+      }
+
+      //Function outputs post simulation results to user. Called once after the last stepFrame()
+      void endSimulation(){
+         PERF_PHASE(PHASE_OUTPUT);
+         //Hits replayed from worker processes are not closed by a frame
+         if(plotExtraction == true){
+            plots.flush(pendingPlots);
+            emitPlots();
+         }
+         pacer.finish(); //Waits for last frame's real-time events to be released
+         if(coverage != NULL){
+            coverage->merge(coverageLocal);
+            coverageLocal.clear();
          }
          //Post simulation output to user
-         cout << "Simulation concluded at " << time/60 <<" minutes." << endl;
-         cout << possibleDetections <<  " search hit(s)" << endl;
-         cout << confirmedDetections << " track initiation(s)" << endl;
+         if(consoleOutput == false){
+            return;
+         }
+         lock_guard<mutex> lock(consoleMutex());
+         cout << siteName << "Simulation concluded at " << time/60 <<" minutes." << endl;
+         cout << siteName << possibleDetections <<  " search hit(s)" << endl;
+         cout << siteName << confirmedDetections << " track initiation(s)" << endl;
+         if(falseAlarmCount > 0){
+            cout << siteName << falseAlarmCount << " of the search hit(s) were false alarm(s)" << endl;
+         }
+         if(pacer.isEnabled()){
+            pacer.printReport();
+         }
       }
       
 
@@ -324,13 +947,21 @@ class radar {
                      inputted target is within the sectors range extent, and if the target is within the current search sectors search
                      beam. If the target fulfils criteria, a detection is made. Criteria for if a target is within the sectors FOV is not
                      needed because of sector logic permitting sending search beams outside of sectors fov extents.
+                     With a Swerling detection model, the SNR criteria is a uniform draw (uniformDraw) below the probability of detection.
+                     The target's position is given by its site relative view at the time of the search beam.
    *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-   bool searchDetection(radarFace* face, searchSector* sector, target* target){
-      if(searchSNR(face, sector,target) >= face->getSNRmin()){  //SNR criteria
-         if((target->getCoordPolar(0) >= (sector->getScanPOS(0) - (face->getHalfPowerBeamWidth(0)/2)))  && (target->getCoordPolar(0) <= (sector->getScanPOS(0)+(face->getHalfPowerBeamWidth(0)/2)))) { //azimuth half-power-beam criteria     
-            if(((target->getCoordPolar(1) <= sector->getScanPOS(1)+ (face->getHalfPowerBeamWidth(1)/2))) && (target->getCoordPolar(1) >= sector->getScanPOS(1)-(face->getHalfPowerBeamWidth(1)/2))){  //elevation half-power-beam criteria            
-               if(target->getCoordPolar(2) >= sector->getRangeExtent(0) && target->getCoordPolar(2) <= sector->getRangeExtent(1)){ //range extent criteria                
-                  storeSearchDetectInfo(face,sector,target); //Add current scanning info for detection
+   bool searchDetection(const facePlan &faceEntry, searchSector* sector, target* target, const targetView &view, double uniformDraw = 0){
+      if((view.polar[0] >= (sector->getScanPOS(0) - (faceEntry.halfPowerBeamWidth[0]/2)))  && (view.polar[0] <= (sector->getScanPOS(0)+(faceEntry.halfPowerBeamWidth[0]/2)))) { //azimuth half-power-beam criteria     
+         if(((view.polar[1] <= sector->getScanPOS(1)+ (faceEntry.halfPowerBeamWidth[1]/2))) && (view.polar[1] >= sector->getScanPOS(1)-(faceEntry.halfPowerBeamWidth[1]/2))){  //elevation half-power-beam criteria            
+            if(view.polar[2] >= sector->getRangeExtent(0) && view.polar[2] <= sector->getRangeExtent(1)){ //range extent criteria                
+               double antennaLoss = 0; //Pattern and scan loss of search beam
+               if(antenna.isEnabled() == true){
+                  antennaLoss = antenna.getLoss(currentFaceIter, sector->getScanPOS(0), sector->getScanPOS(1), view.polar[0] - sector->getScanPOS(0),
+                                                view.polar[1] - sector->getScanPOS(1), faceEntry.halfPowerBeamWidth);
+               }
+               double snr = searchSNR(sector,target,view.polar[2],antennaLoss);
+               if(detection.isDetected(snr, faceEntry.SNRmin, uniformDraw)){  //SNR criteria (hard threshold or probability of detection)
+                  storeSearchDetectInfo(sector,target,view.polar[2],snr); //Add current scanning info for detection
                   return true; //Detection made
                }
             } 
@@ -340,24 +971,9 @@ class radar {
    }
 
       
-      //Function determines if a tracking profile already exists for an inputted target
+      //Function determines if a live tracking profile already exists for an inputted target
       bool targetNewDetection(target *detectedTarget){
-         for(int trackIter = 0; trackIter < trackVector.size(); trackIter++){
-            if(trackVector[trackIter]->getTarget() == detectedTarget ){     //Determining repeat tracking profile for target        
-               return true;
-            }
-         }
-         return false;
-      }
-
-      //Function determines if an inputted target had an existing tracking profile
-      bool targetRedetection(target *detectedTarget){
-         for(int trackIter = 0; trackIter < trackVector.size(); trackIter++){
-            if(trackVector[trackIter]->getTarget() == detectedTarget && trackVector[trackIter]->getActivTrackBool() == false){  //Determining existing tracking profile for target
-               return true;
-            }
-         }
-         return false;
+         return tracks.findLive(detectedTarget) != NULL; //Determining repeat tracking profile for target
       }
 
       
@@ -369,15 +985,26 @@ class radar {
       TO-DO: Introduce some delay between search detection beams and confirmation beams to get a better intial predection of targets
                velocity and acceleration. Currently the two beams are instaneous giving target displacement.
 *////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-      void confirmationScan(tracker *track, double currentTime){
+      //A new track whose confirmation beam misses is parked inactive by default, and is dropped with track coasting or measurement association.
+      //A parked track whose confirmation beam detects the target returns to service.
+      //Input: measuredXYZ = measured position filter is initialized with, NULL uses target's true position (view)
+      void confirmationScan(tracker *track, double currentTime, const targetView &view, const double* measuredXYZ = NULL){
         
-         if(trackDetection(track)==true){
-            track->setActiveTrackBool(true);
-            track->filterInit(currentTime);
+         if(trackDetection(track, view)==true){
+            if(track->getState() == TRACK_INACTIVE){
+               tracks.unpark(track, decoupledTimeline);
+            }
+            tracks.recordDetection(track);
+            track->filterInit(currentTime, (measuredXYZ != NULL) ? measuredXYZ : view.xyz);
             
-            cout << "Target detected, starting track at: ";
-            printCurrentPos_Time(track->getTarget(),currentTime);
-            confirmedDetections = confirmedDetections + 1;
+            emitTrackMessage("Target detected, starting track at: ", track->getTarget(), currentTime);
+            emitTrackEvent(TRACK_STARTED, track, currentTime);
+         }
+         else if(measurementAssociation == true){
+            tracks.drop(track);
+         }
+         else if(track->getState() == TRACK_TENTATIVE){
+            tracks.lose(track);
          }
       }
       
@@ -391,29 +1018,53 @@ class radar {
          all criteria. The azimuth rollover logic below may be the issue or the tracker algorithm. 
 
 *//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-      bool trackDetection(tracker* track){
+      bool trackDetection(tracker* track, const targetView &view){
          target* trackedTarget = track->getTarget(); //Obtaining target from tracker profile
-         for(int faceIter = 0; faceIter < faceVector.size(); faceIter++){ //Simulating criteria for all radar faces
-             if(trackSNR(faceVector[faceIter],trackedTarget) >= trackingSNRmin){   //SNR criteria
-               if((trackedTarget->getCoordPolar(0) >= (track->getNextScanPos(0) - (trackBeamWidth[0]/2)))  && (trackedTarget->getCoordPolar(0) <= (track->getNextScanPos(0) +(trackBeamWidth[0]/2)))) { //inside track beam (azimuth) criteria
-                  if(((trackedTarget->getCoordPolar(1) <= track->getNextScanPos(1) + ((trackBeamWidth[1]/2))) && (trackedTarget->getCoordPolar(1) >= track->getNextScanPos(1)-(trackBeamWidth[1]/2)))){  //inside track beam (elevation) criteria
-                     if(trackedTarget->getCoordPolar(1) >= faceVector[faceIter]->getElExtent(0) && trackedTarget->getCoordPolar(1) <= faceVector[faceIter]->getElExtent(1)){ //inside radar face's elevation FOV criteria   
-                        //Determining if target is inside radar face's azimuth FOV 
-                        //If statment is used due to logic differing if target is in an FOV that "rollsover" 360 degrees azimuth. (MAY BE CAUSING ACCURACY PROBLEMS)
-                        if(faceVector[faceIter]->getFovRollOverBool() == true){
-                           if(trackedTarget->getCoordPolar(0) <= faceVector[faceIter]->getAzExtent(0) && trackedTarget->getCoordPolar(0) <= faceVector[faceIter]->getAzExtent(1)){
-                              return true;
-                           }
-                        }
-                        else if(faceVector[faceIter]->getFovRollOverBool() == false){
-                           if(trackedTarget->getCoordPolar(0) >= faceVector[faceIter]->getAzExtent(0) && trackedTarget->getCoordPolar(0) <= faceVector[faceIter]->getAzExtent(1)){
-                              return true;
-                           }
-                        }
-                     }
-                  }
+         if(trackedTarget->isActiveAt(view.time) == false){ //Target outside its recorded time span no longer exists
+            return false;
+         }
+         //One uniform draw per track beam, keyed by track beam number (separate key space from search beams) and target ID
+         double uniformDraw = 0;
+         if(detection.isProbabilistic() == true){
+            uniformDraw = rng.uniform(trackBeamKey(), trackedTarget->getTargetID());
+         }
+         return trackBeamDetection(track, trackedTarget, view, uniformDraw);
+      }
+
+      //Function determines if a target (not necessarily the tracked target) is detected by a track's beam, using the criteria of trackDetection()
+      //Inputs: track = track beam is pointed for. trackedTarget = target tested. view = site relative view of target at time of beam.
+      //        uniformDraw = uniform draw of probabilistic detection
+      bool trackBeamDetection(tracker* track, target* trackedTarget, const targetView &view, double uniformDraw){
+         //Inside track beam criteria do not depend on face, tested once before any face's FOV/link budget
+         if((view.polar[0] < (track->getNextScanPos(0) - (trackBeamWidth[0]/2)))  || (view.polar[0] > (track->getNextScanPos(0) +(trackBeamWidth[0]/2)))) { //inside track beam (azimuth) criteria
+            return false;
+         }
+         if(((view.polar[1] > track->getNextScanPos(1) + ((trackBeamWidth[1]/2))) || (view.polar[1] < track->getNextScanPos(1)-(trackBeamWidth[1]/2)))){  //inside track beam (elevation) criteria
+            return false;
+         }
+         for(int faceIter = 0; faceIter < plan->getFaceCount(); faceIter++){ //Simulating criteria for all radar faces
+            const facePlan &faceEntry = plan->getFace(faceIter);
+            if(view.polar[1] < faceEntry.elExtent[0] || view.polar[1] > faceEntry.elExtent[1]){ //inside radar face's elevation FOV criteria
+               continue;
+            }
+            //Determining if target is inside radar face's azimuth FOV 
+            //If statment is used due to logic differing if target is in an FOV that "rollsover" 360 degrees azimuth. (MAY BE CAUSING ACCURACY PROBLEMS)
+            if(faceEntry.fovRollOver == true){
+               if(!(view.polar[0] <= faceEntry.azExtent[0] && view.polar[0] <= faceEntry.azExtent[1])){
+                  continue;
                }
             }
+            else if(!(view.polar[0] >= faceEntry.azExtent[0] && view.polar[0] <= faceEntry.azExtent[1])){
+               continue;
+            }
+            double antennaLoss = 0; //Pattern and scan loss of track beam steered from face
+            if(antenna.isEnabled() == true){
+               antennaLoss = antenna.getLoss(faceIter, track->getNextScanPos(0), track->getNextScanPos(1), view.polar[0] - track->getNextScanPos(0),
+                                             view.polar[1] - track->getNextScanPos(1), trackBeamWidth);
+            }
+            if(detection.isDetected(trackSNR(faceIter,trackedTarget,view.polar[2],antennaLoss), trackingSNRmin, uniformDraw)){   //SNR criteria (hard threshold or probability of detection)
+               return true;
+            }
          }
          return false;
       }
@@ -421,35 +1072,288 @@ class radar {
 
 
 
+      //Function services track beams with measurement-to-track association. Every target inside a track beam that meets the track detection
+      //criteria gives a noisy measurement. Candidate targets of a beam are found from an angular grid of target positions at start of track beams
+      //(one track beamwidth cells, so targets within a beamwidth of beam center are candidates). Measurements are then assigned to tracks
+      //within validation gates (trackAssociation.h); tracks left without a measurement coast or, once coast rules run out, are lost and dropped
+      void serviceAssociatedTracks(vector<target*> &targetVector){
+         targetView view;
+         beamGrid.reset(max(trackBeamWidth[0], trackBeamWidth[1]), 360); //Azimuth cells wrap around north
+         for(int targetIter = 0; targetIter < targetVector.size(); targetIter++){
+            if(targetVector[targetIter]->isActiveAt(time) == true){
+               site.getView(targetVector[targetIter], time, view);
+               beamGrid.insert(targetIter, view.polar[0], view.polar[1], 0);
+            }
+         }
+
+         //Track beams, every beam takes track beam duration whether or not it measures a target
+         measurements.clear();
+         measurementPoints.clear();
+         measuredAt.assign(targetVector.size(), -HUGE_VAL);
+         trackPoints.clear();
+         tracks.compact();
+         const vector<tracker*> &liveTracks = tracks.getActive();
+         for(int trackIter = 0; trackIter < liveTracks.size(); trackIter++){
+            tracker* track = liveTracks[trackIter];
+            associationPoint predicted;
+            for(int i = 0; i < 3; i++){
+               predicted.xyz[i] = track->getEstimatedXYZ(i);
+            }
+            trackPoints.push_back(predicted);
+
+            uint64_t beamKey = trackBeamKey();
+            beamGrid.query(track->getNextScanPos(0), track->getNextScanPos(1), 0, beamCandidates);
+            for(int candidateIter = 0; candidateIter < beamCandidates.size(); candidateIter++){
+               target* beamTarget = targetVector[beamCandidates[candidateIter]];
+               if(beamTarget->isActiveAt(time) == false){
+                  continue;
+               }
+               if(measuredAt[beamCandidates[candidateIter]] == time){
+                  continue; //Target already measured by another track beam at this time (decoupled timeline beams share a time)
+               }
+               site.getView(beamTarget, time, view);
+               double uniformDraw = (detection.isProbabilistic() == true) ? rng.uniform(beamKey, beamTarget->getTargetID()) : 0;
+               if(trackBeamDetection(track, beamTarget, view, uniformDraw) == true){
+                  measuredAt[beamCandidates[candidateIter]] = time;
+                  trackMeasurement measurement;
+                  measurement.time = time;
+                  measurement.source = beamTarget;
+                  measure(view, MEASUREMENT_NOISE_KEY | beamKey, beamTarget->getTargetID(), measurement.position.xyz);
+                  measurements.push_back(measurement);
+                  measurementPoints.push_back(measurement.position);
+               }
+            }
+            if(decoupledTimeline == false){
+               time = time + (1/trackPRF);
+            }
+         }
+
+         //Global nearest neighbor assignment of measurements to tracks. Tracks without a measurement coast or are lost and dropped
+         associator.assign(trackPoints, measurementPoints, trackAssignment);
+         for(int trackIter = 0; trackIter < liveTracks.size(); trackIter++){
+            tracker* track = liveTracks[trackIter];
+            int measIter = trackAssignment[trackIter];
+            if(measIter >= 0){
+               track->setTarget(measurements[measIter].source);
+               track->updateFilter(measurements[measIter].time, measurements[measIter].position.xyz);
+               tracks.recordDetection(track);
+               emitTrackEvent(TRACK_UPDATED, track, measurements[measIter].time);
+            }
+            else if(tracks.recordMiss(track, time) == true){
+               emitTrackMessage("Lost track of target at: ", track->getTarget(), time);
+               emitTrackEvent(TRACK_LOST, track, time);
+               tracks.drop(track); //Lost tracks are dropped with association, a later detection starts a new track
+            }
+            else{
+               track->coast(time + refreshRate); //Coasting track's prediction carried to next frame's track beams
+            }
+         }
+         tracks.compact();
+
+         //Track positions search detections are gated against during rest of frame
+         associator.resetTracks();
+         for(int trackIter = 0; trackIter < liveTracks.size(); trackIter++){
+            double xyz[3] = {liveTracks[trackIter]->getEstimatedXYZ(0), liveTracks[trackIter]->getEstimatedXYZ(1), liveTracks[trackIter]->getEstimatedXYZ(2)};
+            associator.addTrack(xyz);
+         }
+      }
+
+      //Function starts a track on a search detection with measurement association. No track is started if the noisy measurement falls inside
+      //an existing track's gate. A confirmation beam is sent to the detection, tracks it does not confirm are dropped.
+      //Returns true if a confirmation beam was sent
+      bool initiateAssociatedTrack(target* detectedTarget, double detectTime, double azScan, double elScan, const targetView &view){
+         double searchXYZ[3];
+         measure(view, MEASUREMENT_NOISE_KEY | dwellCount, detectedTarget->getTargetID(), searchXYZ);
+         if(associator.findTrack(searchXYZ) >= 0){
+            return false; //Detection of an already tracked target
+         }
+         tracker* newTrack = addTrack(detectedTarget, detectTime, azScan, elScan, searchXYZ);
+         double confirmXYZ[3];
+         measure(view, MEASUREMENT_NOISE_KEY | CONFIRM_NOISE_KEY | dwellCount, detectedTarget->getTargetID(), confirmXYZ);
+         confirmationScan(newTrack, detectTime, view, confirmXYZ);
+         if(newTrack->getActivTrackBool() == true){
+            double xyz[3] = {newTrack->getEstimatedXYZ(0), newTrack->getEstimatedXYZ(1), newTrack->getEstimatedXYZ(2)};
+            associator.addTrack(xyz); //Later detections of target in this frame gate to new track
+         }
+         return true;
+      }
+
+      //Function starts tracks from the plots extracted from a face's frame, the way a search detection starts a track without plot extraction.
+      //A plot's target is the target of its strongest hit. Confirmation beams are sent to plots' centroids one after another once the face's
+      //search beams of the frame are sent. Plots of false alarms were already sent a confirmation beam by searchFalseAlarms()
+      //Inputs: startTime = time face's last search beam ended (seconds). view = storage for site relative view of plots' targets
+      void startPlotTracks(double startTime, targetView &view){
+         double beamTime = startTime;
+         for(int plotIter = 0; plotIter < pendingPlots.size(); plotIter++){
+            const plotRecord &plot = pendingPlots[plotIter];
+            target* plotTarget = plot.detectedTarget;
+            if(plotTarget == NULL || plotTarget->isActiveAt(beamTime) == false){
+               continue;
+            }
+            site.getView(plotTarget, beamTime, view);
+            if(measurementAssociation == true){
+               if(initiateAssociatedTrack(plotTarget, beamTime, plot.azPos, plot.elPos, view) == false){
+                  continue;
+               }
+            }
+            else{
+               tracker* existingTrack = tracks.findLive(plotTarget);
+               if(existingTrack == NULL){
+                  tracker* newTrack = addTrack(plotTarget, beamTime, plot.azPos, plot.elPos, view.xyz);
+                  confirmationScan(newTrack, beamTime, view);
+               }
+               else if(existingTrack->getActivTrackBool() == false){
+                  confirmationScan(existingTrack, beamTime, view);
+               }
+               else{
+                  continue; //Target already tracked
+               }
+            }
+            if(decoupledTimeline == false){
+               beamTime = beamTime + 1/trackPRF; //Next confirmation beam is sent after this one
+            }
+         }
+      }
+
+      //Function generates false alarms of current search beam (falseAlarms.h). Every false alarm is a search detection without a truth target.
+      //A confirmation beam is sent to each, which finds nothing, so no track is started. With measurement association, alarms inside an
+      //existing track's gate are not sent a confirmation beam. Returns time spent on confirmation beams
+      //Unit: seconds
+      double searchFalseAlarms(const facePlan &faceEntry, searchSector* sector){
+         uint64_t key = CLUTTER_KEY | dwellCount;
+         int count = falseAlarmGenerator::drawCount(rng, key, sector);
+         double confirmTime = 0;
+         for(int alarmIter = 0; alarmIter < count; alarmIter++){
+            falseAlarm alarm = falseAlarmGenerator::drawAlarm(rng, key, alarmIter, sector, faceEntry.halfPowerBeamWidth);
+            searchDetectRecord record;
+            record.time = time;
+            record.dwellTime = dwellStartTime;
+            record.snr = alarm.snr;
+            record.azPos = alarm.azPos;
+            record.elPos = alarm.elPos;
+            record.faceIter = currentFaceIter;
+            record.sectorIter = currentSectorIter;
+            record.range = alarm.range;
+            record.detectedTarget = NULL;
+            emitSearchDetectRecord(record);
+
+            if(measurementAssociation == true){
+               double alarmXYZ[3] = {alarm.azPos, alarm.elPos, alarm.range};
+               utility::degToRad(alarmXYZ);
+               utility::polarRadsToRect(alarmXYZ);
+               if(associator.findTrack(alarmXYZ) >= 0){
+                  continue; //Alarm falls on an existing track
+               }
+            }
+            confirmTime = confirmTime + 1/trackPRF;
+         }
+         return confirmTime;
+      }
+
+      //Function gives a noisy measurement of a target's site relative cartesian position. Noise is drawn per axis, keyed by beam and target ID
+      //Unit: meters
+      void measure(const targetView &view, uint64_t key, int targetID, double measuredXYZ[3]){
+         for(int i = 0; i < 3; i++){
+            measuredXYZ[i] = view.xyz[i] + measurementNoise*rng.normal(key, (uint64_t)targetID*3 + i);
+         }
+      }
+
+      //Function gives random draw key of the next track beam. Decoupled timeline keys start of frame track beams by frame number and
+      //confirmation beams by search beam number, so the key does not depend on other targets
+      uint64_t trackBeamKey(){
+         if(decoupledTimeline == true){
+            if(currentFaceIter < 0){
+               return TRACK_BEAM_KEY | frameCount;
+            }
+            return TRACK_BEAM_KEY | CONFIRM_BEAM_KEY | dwellCount;
+         }
+         trackBeamCount = trackBeamCount + 1;
+         return TRACK_BEAM_KEY | (trackBeamCount - 1);
+      }
+
       //Function uses the "track" form of the Radar Range Equation (RRE) to determine received SNR in units of decible
-      double trackSNR(radarFace* face, target* target){
+      //Input: range = site relative range of target (meters). antennaLoss = beam pattern and scan loss (decible)
+      double trackSNR(int faceIter, target* target, double range, double antennaLoss = 0){
 
-         //10*log10(290) is converting standard temperature (kelvin) to dB
-         //10*log10(1.38*pow(10,-23)) is Boltzmann's constant to dB
-         double snr = 10*log10(face->getPeakPower())  + 20*log10(face->getEffectiveAttenaArea()) + target->getRCS()
-          - 30*log10(3.14*4) - 40*log10(target->getCoordPolar(2)) - 10*log10(1.38*pow(10,-23)) - 10*log10(290) -  face->getTotalSysLoss() - face->getNoiseFigure() - 20*log10(face->getWavelength());
-         face->setReceivedSNR(snr);
-         
+         //Target independent terms (power, antenna area, Boltzmann's constant, standard temperature, losses, wavelength) are
+         //precomputed per face by the simulation plan
+         double snr = plan->getFace(faceIter).trackSNRConstant + target->getRCS() - 40*log10(range) - antennaLoss;
          return snr;
       }
       
       //Function contains the "search" form of the Radar Range Equation (RRE) to determine received SNR in units of decible
-      double searchSNR(radarFace* face, searchSector* sector, target* target){
+      //Input: range = site relative range of target (meters). antennaLoss = beam pattern and scan loss (decible)
+      double searchSNR(searchSector* sector, target* target, double range, double antennaLoss = 0){
 
          //10*log10(sector->getAngularSearchVolume() /3283) from degrees^2 to steradian then to dB
          //10*log10(290) is converting standard temperature (kelvin) to dB
          //10*log10(1.38*pow(10,-23)) is Boltzmann's constant to dB
-         double snr = 10*log10(face->getPowerAvg()) + 10*log10(face->getEffectiveAttenaArea()) + 10*log10(sector->getRefreshRate()) + target->getRCS()
-          - 10*log10(3.14*4) - 10*log10(sector->getAngularSearchVolume()/3283) - 40*log10(target->getCoordPolar(2)) - 10*log10(1.38*pow(10,-23)) - 10*log10(290) -  face->getTotalSysLoss() - face->getNoiseFigure();
-          face->setReceivedSNR(snr);
-          
+         //Target independent terms are precomputed per sector by the simulation plan
+         double snr = sector->getSearchSNRConstant() + target->getRCS() - 40*log10(range) - antennaLoss;
          return snr;
       }
 
+      //Function initializes every sector's search link budget constant and maximum detectable range for the largest RCS present.
+      //Called before the first frame and again whenever targets are added
+      void initializeSearchRanges(){
+         vector<target*> &targetVector = *targetTable;
+         double maxRCS = -1000;
+         for(int targetIter = 0; targetIter < targetVector.size(); targetIter++){
+            maxRCS = max(maxRCS, targetVector[targetIter]->getRCS());
+         }
+         for(int faceIter = 0; faceIter < plan->getFaceCount(); faceIter++){
+            const facePlan &faceEntry = plan->getFace(faceIter);
+            for(int sectorIndex = faceEntry.firstSector; sectorIndex < faceEntry.firstSector + faceEntry.sectorCount; sectorIndex++){
+               sectorTable[sectorIndex]->setSearchSNRConstant(plan->getSectorTable()[sectorIndex].searchSNRConstant);
+               sectorTable[sectorIndex]->initializeMaxDetectRange(maxRCS, detection.getCullingSNR(faceEntry.SNRmin));
+            }
+         }
+         searchRangesDirty = false;
+      }
+
+      //Function gathers, for every sector of the current radar face, the targets the sector could detect during the face's interval frame starting at
+      //startTime, then schedules them on the search beams that could illuminate them. Without range culling every target is gathered
+      //Unit: seconds
+      void cullTargets(double startTime){
+         PERF_PHASE(PHASE_PROPAGATION);
+         vector<target*> &targetVector = *targetTable;
+         const facePlan &faceEntry = plan->getFace(currentFaceIter);
+         searchSector** faceSectors = &sectorTable[faceEntry.firstSector]; //Face's search sectors
+         double window = refreshRate + plan->getMaxDwellTime(); //Interval frame plus one overrunning dwell of any face, so faces share builds
+         //Pipelined execution, using targets propagated to frame ahead of time by truth stage
+         if(truth.isRunning() == true){
+            truth.take(startTime, window, cullIndex, schedule);
+         }
+         sectorCandidates.resize(faceEntry.sectorCount);
+         if(rangeCulling == false){
+            for(int sectorIter = 0; sectorIter < faceEntry.sectorCount; sectorIter++){
+               sectorCandidates[sectorIter].resize(targetVector.size());
+               for(int targetIter = 0; targetIter < targetVector.size(); targetIter++){
+                  sectorCandidates[sectorIter][targetIter] = targetIter;
+               }
+            }
+         }
+         else{
+            if(cullIndex.covers(startTime, window) == false){
+               cullIndex.build(targetVector, site, startTime, window);
+            }
+            for(int sectorIter = 0; sectorIter < faceEntry.sectorCount; sectorIter++){
+               cullIndex.query(faceSectors[sectorIter]->getRangeExtent(0), faceSectors[sectorIter]->getMaxDetectRange(), sectorCandidates[sectorIter]);
+            }
+         }
+
+         if(illuminationScheduling == true){
+            schedule.build(faceEntry, faceSectors, sectorCandidates, targetVector, site, startTime, window);
+         }
+      }
+
       //Function displays all target, radar, radarFace, and search sector parameters to user's console
       void printSimInfo(radar &radarSim ){
+         vector<target*> &targetVector = *targetTable;
          
          cout <<"Simulated Radar: " << endl;
+         cout <<"Site position XYZ= (" << site.getPosition(0) << "," << site.getPosition(1) << "," << site.getPosition(2) << ")m" << endl;
+         cout <<"Site heading= (" << site.getHeading() << ")degree" << endl;
          cout <<"Simulating " << faceVector.size() << " faces"<< endl;
          cout <<"Simulating " << targetVector.size() << " targets"<< endl;
          cout <<"Tracking PRF= (" << trackPRF << ")Hz" << endl;
@@ -487,7 +1391,7 @@ class radar {
             cout << "Total system loss= (" << faceVector[faceIter]->getTotalSysLoss() << ")dB" << endl;
             
 
-            vector<searchSector*> sectorVector = faceVector[faceIter]->getSearchSectorVector();
+            const vector<searchSector*> &sectorVector = faceVector[faceIter]->getSearchSectorVector();
             cout <<  sectorVector.size() << " search sectors for face" << endl;
             for(int sectorIter = 0; sectorIter < sectorVector.size(); sectorIter++){
                cout << "Sector " << sectorIter+1 << " for face " << faceIter + 1 << ":"<< endl;
@@ -508,35 +1412,480 @@ class radar {
       //Function is used to display a targets current coordinates and current simulation time to the user's console. Function is called when a target starts being tracked
       //or when a target looses track.
       void printCurrentPos_Time(target* trackedTarget, double time){
-         cout << "position XYZ: (" << trackedTarget->getCoordXYZ(0) << ","<< trackedTarget->getCoordXYZ(1) <<"," <<trackedTarget->getCoordXYZ(2) <<")m at " << time/60 << "mins" << endl;
+         cout << formatCurrentPos_Time(trackedTarget, time) << endl;
+      }
+
+      //Function formats a targets world coordinates at a simulation time, used by printCurrentPos_Time() and real-time output
+      string formatCurrentPos_Time(target* trackedTarget, double time){
+         double xyz[3];
+         double vel[3];
+         trackedTarget->getStateAt(time, xyz, vel);
+         ostringstream text;
+         text << "position XYZ: (" << xyz[0] << ","<< xyz[1] <<"," <<xyz[2] <<")m at " << time/60 << "mins";
+         return text.str();
+      }
+
+      //Function outputs a track update (track started/lost) to user. In real-time mode the update is buffered until the wall clock reaches eventTime
+      //Unit: seconds
+      void emitTrackMessage(const char* message, target* trackedTarget, double eventTime){
+         PERF_PHASE(PHASE_OUTPUT);
+         if(outputRunning == true){
+            outputEvent event;
+            event.kind = OUTPUT_MESSAGE;
+            event.message = message;
+            event.messageTarget = trackedTarget;
+            event.time = eventTime;
+            outputQueue.push(event);
+            return;
+         }
+         writeTrackMessage(message, trackedTarget, eventTime);
+      }
+
+      //Function prints a track update, or buffers it in real-time mode
+      //Unit: seconds
+      void writeTrackMessage(const char* message, target* trackedTarget, double eventTime){
+         if(pacer.isEnabled()){
+            pacer.queueEvent(eventTime, string(message) + formatCurrentPos_Time(trackedTarget, eventTime));
+            return;
+         }
+         if(consoleOutput == true){
+            lock_guard<mutex> lock(consoleMutex());
+            cout << siteName << message;
+            printCurrentPos_Time(trackedTarget, eventTime);
+         }
+      }
+
+      //Mutex serializing console output of radars running on different threads (radar network sites)
+      static mutex& consoleMutex(){
+         static mutex consoleLock;
+         return consoleLock;
       }
 
       //Upon a search detection, the face,sector,time,snr and scanning position is recorded and saved for .txt output specified by user using "searchDataOutput" function in configManager 
-      void storeSearchDetectInfo(radarFace* face, searchSector* sector, target* target){
-         searchDetecFaceIterVector.push_back(getFaceIter(face));
-         searchDetecSectorIterVector.push_back(face->getSectorVectorIter());
-         searchDetecTimeVector.push_back(time);
-         searchDetectSnrVector.push_back(face->getReceivedSNR());
-         searchDetecAzPosVector.push_back(sector->getScanPOS(0));
-         searchDetecElPosVector.push_back(sector->getScanPOS(1)); 
+      void storeSearchDetectInfo(searchSector* sector, target* target, double range, double snr){
+         searchDetectRecord record;
+         record.time = time;
+         record.dwellTime = dwellStartTime;
+         record.snr = (stateReal)snr; //SNR is stored state (precision.h)
+         record.azPos = sector->getScanPOS(0);
+         record.elPos = sector->getScanPOS(1);
+         record.faceIter = currentFaceIter;
+         record.sectorIter = currentSectorIter;
+         record.range = range;
+         record.detectedTarget = target;
+         emitSearchDetectRecord(record);
       }
 
-      
+      //Function stores a search detection for searchDataOutput and hands it to user callback, caller-owned buffer and real-time output.
+      //Also used to replay detections merged from worker processes (shardedSimulation.h)
+      void emitSearchDetectRecord(const searchDetectRecord &record){
+         PERF_PHASE(PHASE_OUTPUT);
+         //Collecting detection into plot being extracted, plots are extracted by the simulation thread since they start tracks
+         if(plotExtraction == true){
+            plots.addHit(record, plan->getFace(record.faceIter).halfPowerBeamWidth, pendingPlots);
+         }
+         if(outputRunning == true){
+            outputEvent event;
+            event.kind = OUTPUT_DETECTION;
+            event.detection = record;
+            outputQueue.push(event);
+            return;
+         }
+         writeSearchDetectRecord(record);
+      }
+
+      //Function stores/hands out a search detection (output of emitSearchDetectRecord())
+      void writeSearchDetectRecord(const searchDetectRecord &record){
+         PERF_PHASE(PHASE_OUTPUT);
+         possibleDetections = possibleDetections + 1; //Adds to possbile detections counter
+         if(record.detectedTarget == NULL){
+            falseAlarmCount = falseAlarmCount + 1;
+         }
+         if(storeSearchHistory == true){
+            searchDetecFaceIterVector.push_back(record.faceIter);
+            searchDetecSectorIterVector.push_back(record.sectorIter);
+            searchDetecTimeVector.push_back(record.time);
+            searchDetectSnrVector.push_back(record.snr);
+            searchDetecAzPosVector.push_back(record.azPos);
+            searchDetecElPosVector.push_back(record.elPos); 
+         }
+
+         //Counting detection in coverage heatmap
+         if(coverage != NULL){
+            coverageLocal.addDetection(record.faceIter, record.azPos, record.elPos, record.range, record.snr);
+         }
+
+         if(telemetry != NULL){
+            telemetryRecord entry;
+            memset(&entry, 0, sizeof(entry));
+            entry.kind = TELEMETRY_DETECTION;
+            entry.faceIter = record.faceIter;
+            entry.sectorIter = record.sectorIter;
+            entry.targetID = (record.detectedTarget != NULL) ? record.detectedTarget->getTargetID() : -1;
+            entry.time = record.dwellTime;
+            entry.azPos = record.azPos;
+            entry.elPos = record.elPos;
+            entry.range = record.range;
+            entry.snr = record.snr;
+            telemetry->publish(entry);
+         }
+
+         //Handing detection to user callback and/or caller-owned buffer
+         if(detectCallback != NULL){
+            detectCallback(record, detectUserData);
+         }
+         if(detectBuffer != NULL){
+            if(detectBufferCount < detectBufferCapacity){
+               detectBuffer[detectBufferCount] = record;
+               detectBufferCount = detectBufferCount + 1;
+            }
+            else{
+               detectBufferOverflow = detectBufferOverflow + 1;
+            }
+         }
+
+         //Real-time mode, detection is emitted once the wall clock reaches the search beam's time
+         if(pacer.isEnabled()){
+            ostringstream text;
+            text << "Detection(" << record.azPos <<"," << record.elPos << ") at: " << record.dwellTime/60 << "mins on, face " << record.faceIter << "-> sector " << record.sectorIter;
+            pacer.queueEvent(record.dwellTime, text.str());
+         }
+      }
+
+      //Function counts the current search beam in coverage heatmap and publishes its position to telemetry feed
+      void emitBeam(int faceIter, int sectorIter, searchSector* sector){
+         PERF_PHASE(PHASE_OUTPUT);
+         if(outputRunning == true){
+            outputEvent event;
+            event.kind = OUTPUT_BEAM;
+            event.detection.faceIter = faceIter;
+            event.detection.sectorIter = sectorIter;
+            event.detection.dwellTime = dwellStartTime;
+            event.detection.azPos = sector->getScanPOS(0);
+            event.detection.elPos = sector->getScanPOS(1);
+            outputQueue.push(event);
+            return;
+         }
+         writeBeam(faceIter, sectorIter, dwellStartTime, sector->getScanPOS(0), sector->getScanPOS(1));
+      }
+
+      //Function counts a search beam in coverage heatmap and publishes it to telemetry feed
+      //Units: seconds, degrees
+      void writeBeam(int faceIter, int sectorIter, double beamTime, double azPos, double elPos){
+         PERF_PHASE(PHASE_OUTPUT);
+         if(coverage != NULL){
+            coverageLocal.addBeam(faceIter, azPos, elPos);
+         }
+         if(telemetry != NULL){
+            telemetryRecord entry;
+            memset(&entry, 0, sizeof(entry));
+            entry.kind = TELEMETRY_BEAM;
+            entry.faceIter = faceIter;
+            entry.sectorIter = sectorIter;
+            entry.targetID = -1;
+            entry.time = beamTime;
+            entry.azPos = azPos;
+            entry.elPos = elPos;
+            telemetry->publish(entry);
+         }
+      }
+
+      //Function releases a frame's real-time output once the wall clock reaches it
+      //Unit: seconds
+      void emitFrame(double frameTime){
+         if(outputRunning == true){
+            outputEvent event;
+            event.kind = OUTPUT_FRAME;
+            event.time = frameTime;
+            outputQueue.push(event);
+            return;
+         }
+         pacer.emitFrame(frameTime);
+      }
+
+      //Function hands extracted plots out, stored for searchDataOutput/plotDataOutput and handed to user callback
+      void emitPlots(){
+         PERF_PHASE(PHASE_OUTPUT);
+         for(int plotIter = 0; plotIter < pendingPlots.size(); plotIter++){
+            if(outputRunning == true){
+               outputEvent event;
+               event.kind = OUTPUT_PLOT;
+               event.plot = pendingPlots[plotIter];
+               outputQueue.push(event);
+               continue;
+            }
+            writePlot(pendingPlots[plotIter]);
+         }
+         pendingPlots.clear();
+      }
+
+      //Function stores/hands out an extracted plot (output of emitPlots())
+      void writePlot(const plotRecord &plot){
+         PERF_PHASE(PHASE_OUTPUT);
+         if(storeSearchHistory == true){
+            plotVector.push_back(plot);
+         }
+         if(plotCallbackFunction != NULL){
+            plotCallbackFunction(plot, plotUserData);
+         }
+      }
+
+      //Upon a track event, the event is handed to user callback and/or caller-owned buffer
+      void emitTrackEvent(trackEventType type, tracker* track, double eventTime){
+         trackEventRecord record;
+         record.type = type;
+         record.time = eventTime;
+         record.nextScanAz = track->getNextScanPos(0);
+         record.nextScanEl = track->getNextScanPos(1);
+         record.faceIter = currentFaceIter;
+         record.track = track;
+         record.trackedTarget = track->getTarget();
+         emitTrackEventRecord(record);
+      }
+
+      //Function hands a track event to user callback and/or caller-owned buffer. Also used to replay track events merged from worker processes
+      void emitTrackEventRecord(const trackEventRecord &record){
+         PERF_PHASE(PHASE_OUTPUT);
+         double estimatedXYZ[3] = {0, 0, 0}; //Track profiles of replayed events live in worker processes
+         for(int i = 0; i < 3 && telemetry != NULL && record.track != NULL; i++){
+            estimatedXYZ[i] = record.track->getEstimatedXYZ(i);
+         }
+         if(outputRunning == true){
+            outputEvent event;
+            event.kind = OUTPUT_TRACK;
+            event.track = record; //Estimated position is taken now, track profile keeps changing while event waits in queue
+            for(int i = 0; i < 3; i++){
+               event.estimatedXYZ[i] = estimatedXYZ[i];
+            }
+            outputQueue.push(event);
+            return;
+         }
+         writeTrackEventRecord(record, estimatedXYZ);
+      }
+
+      //Function hands a track event out (output of emitTrackEventRecord())
+      //Input: estimatedXYZ = track's estimated position at time of event, published to telemetry. (meters)
+      void writeTrackEventRecord(const trackEventRecord &record, const double estimatedXYZ[3]){
+         PERF_PHASE(PHASE_OUTPUT);
+         if(record.type == TRACK_STARTED){
+            confirmedDetections = confirmedDetections + 1; //Adds to track profile counter
+         }
+         if(telemetry != NULL){
+            telemetryRecord entry;
+            memset(&entry, 0, sizeof(entry));
+            entry.kind = TELEMETRY_TRACK;
+            entry.faceIter = record.faceIter;
+            entry.sectorIter = record.type;
+            entry.targetID = (record.trackedTarget != NULL) ? record.trackedTarget->getTargetID() : -1;
+            entry.time = record.time;
+            entry.azPos = record.nextScanAz;
+            entry.elPos = record.nextScanEl;
+            for(int i = 0; i < 3; i++){
+               entry.xyz[i] = estimatedXYZ[i];
+            }
+            telemetry->publish(entry);
+         }
+         if(trackCallback != NULL){
+            trackCallback(record, trackUserData);
+         }
+         if(trackBuffer != NULL){
+            if(trackBufferCount < trackBufferCapacity){
+               trackBuffer[trackBufferCount] = record;
+               trackBufferCount = trackBufferCount + 1;
+            }
+            else{
+               trackBufferOverflow = trackBufferOverflow + 1;
+            }
+         }
+      }
+
+      //Function starts truth and output stages of a pipelined simulation. Without range culling and illumination scheduling search beams test
+      //every target, so there is no truth to propagate ahead and only the output stage is started
+      void startPipeline(){
+         if(rangeCulling == true || illuminationScheduling == true){
+            truth.start(targetTable, &site, rangeCulling, illuminationScheduling, PIPELINE_TRUTH_DEPTH);
+            nextTruthTime = time;
+         }
+         outputQueue.reset(PIPELINE_OUTPUT_CAPACITY);
+         outputRunning = true;
+         outputWorker = thread(runOutputStage, this);
+      }
+
+      //Function stops truth stage and waits for output stage to emit every record queued
+      void stopPipeline(){
+         truth.stop();
+         if(outputRunning == false){
+            return;
+         }
+         outputEvent event;
+         event.kind = OUTPUT_STOP;
+         outputQueue.push(event);
+         outputWorker.join();
+         outputRunning = false;
+      }
+
+      //Function requests truth frames of upcoming frames. Called once a frame's tracks are serviced
+      void requestTruthFrames(){
+         double window = refreshRate + plan->getMaxDwellTime(); //Same window as cullTargets()
+         //Decoupled timeline, frames start every refreshRate, so frames are requested up to truth stage depth ahead
+         if(decoupledTimeline == true){
+            while(truth.canRequest() == true){
+               truth.request(nextTruthTime, window);
+               nextTruthTime = nextTruthTime + refreshRate;
+            }
+            return;
+         }
+         //Next frame starts refreshRate after this frame's search, its search is then delayed by its own track beams. Window is widened
+         //for twice the beams of tracks live now, as tracks started during this frame's search are serviced too
+         if(truth.canRequest() == true){
+            double trackBeams = 2*(tracks.getActive().size() + 1)/trackPRF;
+            truth.request(time + refreshRate, window + trackBeams);
+         }
+      }
+
+      //Output stage thread of pipelined simulation, emits queued records in order until simulation ends
+      static void runOutputStage(radar* radarSim){
+         PERF_PHASE(PHASE_OUTPUT);
+         outputEvent event;
+         while(true){
+            radarSim->outputQueue.pop(event);
+            switch(event.kind){
+               case OUTPUT_DETECTION:
+                  radarSim->writeSearchDetectRecord(event.detection);
+                  break;
+               case OUTPUT_TRACK:
+                  radarSim->writeTrackEventRecord(event.track, event.estimatedXYZ);
+                  break;
+               case OUTPUT_MESSAGE:
+                  radarSim->writeTrackMessage(event.message, event.messageTarget, event.time);
+                  break;
+               case OUTPUT_BEAM:
+                  radarSim->writeBeam(event.detection.faceIter, event.detection.sectorIter, event.detection.dwellTime, event.detection.azPos, event.detection.elPos);
+                  break;
+               case OUTPUT_PLOT:
+                  radarSim->writePlot(event.plot);
+                  break;
+               case OUTPUT_FRAME:
+                  radarSim->pacer.emitFrame(event.time);
+                  break;
+               case OUTPUT_STOP:
+                  return;
+            }
+         }
+      }
+
+
 
       
 
 
     private:
-         vector<radarFace*> faceVector;   //Contains all the radar face objects in current radar simulation
-         vector<target*> targetVector;    //Contains all target objects simulate in current simulation
-         vector<tracker*> trackVector;    //Contains all tracking profiles
+         static const uint64_t TRACK_BEAM_KEY = 1ULL << 63;   //Random draw key space of track beams
+         static const uint64_t CLUTTER_KEY = 1ULL << 62;      //Random draw key space of false alarms, keyed by search beam number
+         static const uint64_t CONFIRM_BEAM_KEY = 1ULL << 61; //Random draw key space of confirmation beams (decoupled timeline)
+         static const uint64_t MEASUREMENT_NOISE_KEY = 1ULL << 60; //Random draw key space of measurement noise (measurement association)
+         static const uint64_t CONFIRM_NOISE_KEY = 1ULL << 59;     //Measurement noise of confirmation beams, within MEASUREMENT_NOISE_KEY
+
+         //Noisy measurement made by a track beam (measurement association)
+         struct trackMeasurement {
+            double time;                  //Time of track beam. (seconds)
+            target* source;               //Truth target measured
+            associationPoint position;    //Measured site relative cartesian position. (meters)
+         };
+
+         vector<radarFace*> faceVector;   //Contains all the radar face objects in current radar simulation (configuration, plan is compiled from it)
+         vector<searchSector*> sectorTable; //Search sectors of every face in plan order, face's sectors consecutive (indexed like plan's sector table)
+         vector<int> nextSector;          //Sector of each face (position within face) its next search beam is sent in
+         shared_ptr<const simulationPlan> plan; //Compiled faces/sectors, read-only and possibly shared
+         vector<target*> targetVector;    //Contains all target objects simulate in current simulation (radar's own targets)
+         vector<target*>* targetTable;    //Target table radar observes, targetVector or a radar network's shared table
+         bool sharedTargets;              //Determines if targetTable is shared with other radar network sites
+         radarSite site;                  //Position/orientation of radar, used to view targets in site relative coordinates
+         string siteName;                 //Name printed in front of radar's console output
+         trackPool tracks;                //Contains all tracking profiles, live tracks in service order
          double simLength;                //Simulated time spent running simulation. (Seconds)
          double time;                     //Current simulation time. (Seconds)
+         double dwellStartTime;           //Time current search beam was sent. (Seconds)
          double refreshRate;              //Time simulation spends in a frame of refrence. (Seconds)
          double trackBeamWidth[2];        //HalfPower beamwidth used for tracking. 0 = azimuth beamwidth. 1 = elevation beamwidth. (Degrees)
          double trackPRF;                 //Theoretical amount of scans used in tracking per second. (Hertz)
          double trackingSNRmin;           //Floor threshold for Signal-to-Noise ratio during tracking. (dB)
          double A_B_gammaWeights[3];      //Alpha-Beta-Gamma weights for tracking filter. 0 = alpha. 1 = beta. 2 = gamma. (unitless)
+         realTimePacer pacer;             //Paces simulation against wall clock when real-time mode is enabled
+
+         //Variables used for handing records to an embedding simulation
+         bool storeSearchHistory;                  //Determines if search detections are stored in detection vectors below
+         bool consoleOutput;                       //Determines if track updates and simulation summary are printed to console
+
+         //Variables used for range culling
+         bool rangeCulling;                        //Determines if targets outside a sector's detectable range are skipped
+         bool searchRangesDirty;                   //Determines if sector link budgets/detectable ranges need to be initialized
+         rangeCullIndex cullIndex;                 //Range-sorted index of targets for current interval frame (shared by faces)
+         vector< vector<int> > sectorCandidates;   //Targets each sector of current face could detect (targetVector positions)
+
+         //Variables used for illumination scheduling
+         bool illuminationScheduling;              //Determines if search beams skip targets outside their beam during the interval frame
+         illuminationSchedule schedule;            //Targets scheduled on each search beam of current face's interval frame
+
+         //Variables used for probabilistic detection
+         detectionModel detection;                 //Hard SNR threshold or Swerling probability of detection
+         antennaPattern antenna;                   //Beam pattern and scan loss tables of search/track beams
+         counterRNG rng;                           //Counter-based generator for detection draws
+         int nextTargetID;                         //ID given to next added target
+         uint64_t dwellCount;                      //Amount of search beams sent, key of search beam draws
+         uint64_t trackBeamCount;                  //Amount of probabilistic track beams sent, key of track beam draws
+         uint64_t frameCount;                      //Amount of simulation frames run, key of track beam draws (decoupled timeline)
+         int currentFaceIter;                      //Radar face currently searching, -1 while track beams are serviced
+         int currentSectorIter;                    //Sector of current face sending current search beam, -1 while track beams are serviced
+         bool decoupledTimeline;                   //Determines if track/confirmation beams are scheduled outside of the search timeline
+         vector<uint64_t> candidateIDs;            //IDs of current search beam's candidate targets
+         vector<double> dwellDraws;                //Uniform draws of current search beam's candidate targets
+         searchDetectCallback detectCallback;      //User function called on every search detection
+         void* detectUserData;                     //User pointer handed to detectCallback
+         trackEventCallback trackCallback;         //User function called on every track event
+         void* trackUserData;                      //User pointer handed to trackCallback
+         bool plotExtraction;                      //Determines if search detections are merged into plots
+         plotExtractor plots;                      //Clusters search detections of a frame/face into plots
+         vector<plotRecord> pendingPlots;          //Plots extracted but not yet handed out
+         plotCallback plotCallbackFunction;        //User function called on every extracted plot
+         void* plotUserData;                       //User pointer handed to plotCallbackFunction
+         coverageMap* coverage;                    //Caller-owned coverage map, NULL = no coverage heatmaps
+         coverageMap coverageLocal;                //Coverage accumulated by radar during simulation, merged into coverage at end
+         telemetryFeed* telemetry;                 //Caller-owned live telemetry feed, NULL = no telemetry
+
+         //Variables used for pipelined execution
+         static const int PIPELINE_TRUTH_DEPTH = 4;        //Most truth frames requested ahead
+         static const int PIPELINE_OUTPUT_CAPACITY = 4096; //Records queued between sensing and output stage
+         bool pipelinedExecution;                  //Determines if startSimulation() runs truth, sensing and output stages on their own threads
+         truthStage truth;                         //Propagates targets to upcoming frames (pipelined execution)
+         spscQueue<outputEvent> outputQueue;       //Records emitted by sensing, waiting for output stage
+         thread outputWorker;                      //Output stage thread
+         bool outputRunning;                       //Records are handed to output stage instead of being emitted directly
+         double nextTruthTime;                     //Start of next frame truth is requested for (decoupled timeline)
+
+         //Variables used for false alarms
+         bool falseAlarmGeneration;                //Determines if sectors with a probability of false alarm generate false alarms
+         long falseAlarmCount;                     //Amount of search hits that were false alarms
+
+         //Variables used for measurement association
+         bool measurementAssociation;              //Determines if tracks are maintained by measurement-to-track association
+         double measurementNoise;                  //Standard deviation of measurement noise per axis. (meters)
+         trackAssociator associator;               //Gates and assigns measurements to tracks
+         spatialGrid beamGrid;                     //Target angles at start of track beams, used to find targets inside a track beam
+         vector<int> beamCandidates;               //Targets near current track beam
+         vector<trackMeasurement> measurements;    //Measurements of current scan's track beams
+         vector<associationPoint> measurementPoints; //Measured positions of current scan's track beams
+         vector<double> measuredAt;                //Time each target was last measured by current scan's track beams (targetVector positions)
+         vector<associationPoint> trackPoints;     //Predicted positions of tracks of current scan
+         vector<int> trackAssignment;              //Measurement assigned to each track of current scan
+         searchDetectRecord* detectBuffer;         //Caller-owned buffer search detections are written into
+         int detectBufferCapacity;                 //Capacity of detectBuffer
+         int detectBufferCount;                    //Amount of detections written into detectBuffer
+         long detectBufferOverflow;                //Amount of detections that did not fit in detectBuffer
+         trackEventRecord* trackBuffer;            //Caller-owned buffer track events are written into
+         int trackBufferCapacity;                  //Capacity of trackBuffer
+         int trackBufferCount;                     //Amount of track events written into trackBuffer
+         long trackBufferOverflow;                 //Amount of track events that did not fit in trackBuffer
          
          //Variables used for outputting information
          int possibleDetections;                   //Holds all detections from search
@@ -547,6 +1896,7 @@ class radar {
          vector<double> searchDetecElPosVector;    //Stores elevation scan position when search detection was made
          vector<int> searchDetecFaceIterVector;    //Stores the radar face that made search detection
          vector<int> searchDetecSectorIterVector;  //Stores the search sector that made search detection       
+         vector<plotRecord> plotVector;            //Stores all extracted plots
 };
 
 #endif
\ No newline at end of file
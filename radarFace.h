@@ -11,6 +11,7 @@
 #define RADARFACE_H
 #include "searchSector.h"
 #include "utility.h"
+#include "precision.h"
 #include "configManager.h"
 #include "target.h"
 #include <iostream>
@@ -23,9 +24,7 @@ using namespace std;
 class radarFace {
 
    public:
-      radarFace(){
-         sectorIter = 0;    //Starts all radar faces with 0th sector, or "First" search sector.
-      }
+      radarFace(){}
       ~radarFace(){}
 
 
@@ -33,10 +32,9 @@ class radarFace {
 //Getter and setter related functions
 
       //Sets face's boresight, which essentially is middle line of sight of radar face
-      //Unit: degrees
-      void setBoresight(double azimuth, double elevation){
-            boresight[0] = azimuth;
-            boresight[1] = elevation;
+      void setBoresight(angleValue azimuth, angleValue elevation){
+            boresight[0] = azimuth / units::deg;
+            boresight[1] = elevation / units::deg;
          }
 
       //Gets face's boresight in either azimuth or elevation position
@@ -48,10 +46,9 @@ class radarFace {
 
       //Sets face's azimuth FOV extent and also determines if FOV rolls over from 360 degrees to 0 degrees 
       //Input: begin= "leftmost" azimuth position. end = "rightmost" azimuth position
-      //Unit: degrees
-      void setAzExtent(double begin, double end){
-         fovExtentAz[0] = begin;
-         fovExtentAz[1] = end;
+      void setAzExtent(angleValue begin, angleValue end){
+         fovExtentAz[0] = begin / units::deg;
+         fovExtentAz[1] = end / units::deg;
          if(fovExtentAz[1]< fovExtentAz[0]){
             fovRollOver = true; //FOV rolls over 360 degrees
          } 
@@ -69,10 +66,9 @@ class radarFace {
 
       //Sets elevation FOV extent
       //Input: begin= lowest elevation position. end = highest elevation position
-      //Unit: degrees
-      void setElExtent(double begin, double end){
-         fovExtentEl[0] = begin; //Lowest position
-         fovExtentEl[1] = end;   //Highest position
+      void setElExtent(angleValue begin, angleValue end){
+         fovExtentEl[0] = begin / units::deg; //Lowest position
+         fovExtentEl[1] = end / units::deg;   //Highest position
       
       }
 
@@ -85,10 +81,9 @@ class radarFace {
 
       //Sets face's half-power-beamwidth for search beams
       //Input: az3db = azimuth halfpower beamwidth. el3db = elevation halfpower beamwidth
-      //Unit: degrees
-      void setHalfPowerBeamWidth(double az3dB, double el3dB){
-         halfPowerBeamWidth[0] = az3dB; //azimuth 3db beamwidth
-         halfPowerBeamWidth[1] = el3dB; //elevation 3db beamwidth
+      void setHalfPowerBeamWidth(angleValue az3dB, angleValue el3dB){
+         halfPowerBeamWidth[0] = az3dB / units::deg; //azimuth 3db beamwidth
+         halfPowerBeamWidth[1] = el3dB / units::deg; //elevation 3db beamwidth
       }
 
       //Gets half-power-beamwidth in either azimuth or elevation
@@ -99,9 +94,8 @@ class radarFace {
       }
 
       //Sets face's minimum detectable SNR value for search detection
-      //Unit: decible
-      void setSNRmin(double snr){
-         SNRmin = snr;
+      void setSNRmin(decibelValue snr){
+         SNRmin = snr / units::dB;
       }
 
       //Gets face's minimum detectable SNR value for search detection
@@ -111,9 +105,8 @@ class radarFace {
       }
 
       //Sets frequency of search waves/beams
-      //Unit: gigahertz
-      void setWaveFreq(double frequency){
-         waveFreq = utility::GhzToHz(frequency); //convertz gigahertz to hertz
+      void setWaveFreq(frequencyValue frequency){
+         waveFreq = frequency / units::Hz;
       }
 
       //Gets frequency of search waves/beams
@@ -123,9 +116,8 @@ class radarFace {
       }
 
       //Sets bandwidth of search waves/beams
-      //Unit: kilohertz
-      void setBandwidth(double trasnmitBW){
-         bandwith = utility::kiloToBase(trasnmitBW); //Converts kilohertz to hertz
+      void setBandwidth(frequencyValue trasnmitBW){
+         bandwith = trasnmitBW / units::Hz;
       }
 
       //Gets bandwidth of search waves/beams
@@ -147,9 +139,8 @@ class radarFace {
       }
 
       //Sets peak power supplied to radar face
-      //Unit: kiloWatts
-      void setPeakPower(double Kwatts){
-         peakPower = utility::kiloToBase(Kwatts); //Converts kilowatts to watts
+      void setPeakPower(powerValue power){
+         peakPower = power / units::W;
       }
 
       //Gets peak power supplied to radar face
@@ -159,9 +150,8 @@ class radarFace {
       }
 
       //Sets noise figure of radar face
-      //Unit: decible
-      void setNoiseFigure(double noise){
-         noiseFigure = noise;
+      void setNoiseFigure(decibelValue noise){
+         noiseFigure = noise / units::dB;
       }
 
       //Gets noise figure of radar face
@@ -171,9 +161,8 @@ class radarFace {
       }
 
       //Sets total system loss for specific radar face
-      //Unit: decible
-      void setTotalSysLoss(double loss){
-         totalSysLoss = loss;
+      void setTotalSysLoss(decibelValue loss){
+         totalSysLoss = loss / units::dB;
       }
 
       //Gets total system loss for specific radar face
@@ -187,28 +176,11 @@ class radarFace {
          searchSectorVector.push_back(&sector);
       }
 
-      //Gets vector containing all search sector objects for radar face
-      vector<searchSector*> getSearchSectorVector(){
+      //Gets vector containing all search sector objects for radar face (no copy, valid while radar face exists)
+      const vector<searchSector*>& getSearchSectorVector(){
          return searchSectorVector;
       }
 
-      //Gets the current sector iterator, which is the current search sector the radar face is scanning in
-      int getSectorVectorIter(){
-         return sectorIter;
-      }
-
-      //Sets the SNR receieved from current search beam
-      //Unit: decible
-      void setReceivedSNR(double snr){
-         receivedSNR = snr;
-      }
-
-      //Gets the SNR receieved from current search beam
-      //Unit: decible
-      double getReceivedSNR(){
-         return receivedSNR;
-      }
-
       //Gets the average power supplied to radar face
       //Unit: watts
       double getPowerAvg(){
@@ -227,14 +199,6 @@ class radarFace {
       }
 ////////////////////////////////////////////////////////////////////////////////////////////
 
-      //Function iterates the current search sector the radar face is using to search
-      void incrementSectorVectorIter(){
-         sectorIter = sectorIter + 1;
-            if(sectorIter == searchSectorVector.size()){ //If statment determines if current iteration is the last sector before iterating back to first sector
-               sectorIter = 0;
-            }
-      }
-
       //Function determines face's average power
       //Unit: hertz
       void initializePowerAvg(double trackPRF){
@@ -245,20 +209,18 @@ class radarFace {
       
 
       private:
-         double boresight[2];             //Contains the boresight or "center position" of radar face. 0 = azimuth position. 1 = elevation position. (degrees)
-         double fovExtentAz[2];           //Field of view in azimuth frame. 0 = leftmost or furtherest counterclockwise position. 1 = rightmost or furthest clockwise position. (degrees)
-         double fovExtentEl[2];           //Field of view in elevation frame. 0 = lowest elevation position. 1 = highest elevation posistion. (degrees)
-         double halfPowerBeamWidth[2];    //Searching half-power-beamwidth in azimuth and elevation. 0 = azimuth beamwidth. 1 = elevation beamwidth. (degrees)
-         double SNRmin;                   //Minimum detectable SNR value for search detection. (decible)    
+         stateReal boresight[2];          //Contains the boresight or "center position" of radar face. 0 = azimuth position. 1 = elevation position. (degrees)
+         stateReal fovExtentAz[2];        //Field of view in azimuth frame. 0 = leftmost or furtherest counterclockwise position. 1 = rightmost or furthest clockwise position. (degrees)
+         stateReal fovExtentEl[2];        //Field of view in elevation frame. 0 = lowest elevation position. 1 = highest elevation posistion. (degrees)
+         stateReal halfPowerBeamWidth[2]; //Searching half-power-beamwidth in azimuth and elevation. 0 = azimuth beamwidth. 1 = elevation beamwidth. (degrees)
+         stateReal SNRmin;                //Minimum detectable SNR value for search detection. (decible)    
          double waveFreq;                 //Frequency of search beam. (hertz)
          double bandwith;                 //Bandwidth of wave beam. (hertz)
          double effectiveAttenaArea;      //Effective attena area (includes gain). (meter^2)
          double peakPower;                //Peak power supplied to radar face. (watts)
-         double noiseFigure;              //Internal noise/loss for radar face. (decible)
-         double totalSysLoss;             //Total system loss, e.g. atmospheric, DSP, transmit/receive losses. (decible)  
+         stateReal noiseFigure;           //Internal noise/loss for radar face. (decible)
+         stateReal totalSysLoss;          //Total system loss, e.g. atmospheric, DSP, transmit/receive losses. (decible)  
          double powerAvg;                 //Average power supplied to radar face. (watts)
-         int sectorIter;                  //The current search sector which the radar face is searching
-         double receivedSNR;              //The received SNR detected by radar face. (decible)
          bool fovRollOver;                //Boolean determining if azimuth FOV "rolls over" 360. Example-> FOV from 345degrees to 45degrees.
          vector<searchSector*> searchSectorVector; //Vector contains all sector objects for radar face
       };
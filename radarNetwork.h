@@ -0,0 +1,184 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: radarNetwork.h contains a network of radar sites observing one shared airspace. Every site is a radar
+ *              object with its own position/orientation (radarSite.h), faces, sectors and tracks, but all sites observe
+ *              one shared target table instead of owning a copy of the targets. Targets are only read during simulation,
+ *              each site computes its own site relative view of a target on the fly, so sites are independent of each
+ *              other and are simulated in parallel, one site per thread at a time.
+ *              Targets are added/removed through the network, between calls that run the sites.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef RADARNETWORK_H
+#define RADARNETWORK_H
+#include "radar.h"
+#include "counterRNG.h"
+#include <thread>
+#include <atomic>
+#include <sstream>
+
+using namespace std;
+
+class radarNetwork {
+   public:
+      radarNetwork(){
+         nextTargetID = 0;                      //initializing target ID counter
+         threadCount = 0;                       //one thread per hardware core by default
+         randomSeed = counterRNG().getSeed();   //first site uses same seed as a standalone radar
+      }
+      ~radarNetwork(){}
+
+//////////////////////////////////////////////////////////////////////////////////////
+//Setter and getter related functions
+
+      //Adds radar site to network. Targets a site was configured with are moved into the network's shared target table only while the
+      //table is empty, so the airspace is loaded once. Further sites are configured without targets (configManager::initializeSiteData).
+      //Sites without a name are named by their order in network
+      void addSite(radar &site){
+         if(site.getRealTimePacer().isEnabled()){
+            cout << "Error, real-time mode is not supported for radar network sites" << endl;
+            exit(1);
+         }
+         const vector<target*> &siteTargets = site.getTargetVector();
+         if(siteTargets.size() > 0 && targetVector.size() > 0){
+            cout << "Error, radar network site was configured with its own targets, configure further sites with configManager::initializeSiteData" << endl;
+            exit(1);
+         }
+         for(int targetIter = 0; targetIter < siteTargets.size(); targetIter++){
+            addTarget(*siteTargets[targetIter]);
+         }
+         site.setTargetTable(&targetVector);
+         if(site.getSiteName() == ""){
+            ostringstream name;
+            name << "Site #" << siteVector.size() + 1 << ": ";
+            site.setSiteName(name.str());
+         }
+         site.setRandomSeed(siteSeed(siteVector.size()));
+         siteVector.push_back(&site);
+      }
+
+      //Gets vector containing all radar sites (no copy)
+      const vector<radar*>& getSiteVector(){
+         return siteVector;
+      }
+
+      //Adds target to shared target table observed by every site
+      void addTarget(target &networkTarget){
+         networkTarget.setTargetID(nextTargetID); //Unique network wide ID, used to key random draws for target
+         nextTargetID = nextTargetID + 1;
+         targetVector.push_back(&networkTarget);
+         for(int siteIter = 0; siteIter < siteVector.size(); siteIter++){
+            siteVector[siteIter]->markTargetsChanged();
+         }
+      }
+
+      //Removes target from shared target table along with every site's tracking profiles of the target. Target object is not deleted
+      void removeTarget(target* networkTarget){
+         for(int siteIter = 0; siteIter < siteVector.size(); siteIter++){
+            siteVector[siteIter]->removeTracks(networkTarget);
+         }
+         for(int targetIter = 0; targetIter < targetVector.size(); targetIter++){
+            if(targetVector[targetIter] == networkTarget){
+               targetVector.erase(targetVector.begin() + targetIter);
+               return;
+            }
+         }
+      }
+
+      //Gets shared target table (no copy)
+      const vector<target*>& getTargetVector(){
+         return targetVector;
+      }
+
+      //Sets amount of threads sites are simulated on. 0 = one thread per hardware core
+      void setThreadCount(int threads){
+         threadCount = threads;
+      }
+
+      //Sets seed of random draws. Every site draws from its own seed derived from network seed, so sites fluctuate independently
+      void setRandomSeed(uint64_t seed){
+         randomSeed = seed;
+         for(int siteIter = 0; siteIter < siteVector.size(); siteIter++){
+            siteVector[siteIter]->setRandomSeed(siteSeed(siteIter));
+         }
+      }
+//////////////////////////////////////////////////////////////////////////////////////
+
+      //Function runs every site's full simulation (each site's own simulation length) in parallel
+      void startSimulation(){
+         beginSimulation();
+         runSites(0, true);
+         endSimulation();
+      }
+
+      //Function prepares every site to be run frame by frame. Called once before the first runUntil()
+      void beginSimulation(){
+         for(int siteIter = 0; siteIter < siteVector.size(); siteIter++){
+            siteVector[siteIter]->beginSimulation();
+         }
+      }
+
+      //Function runs every site in parallel until the site's simulation time reaches endTime. Sites advance by whole frames
+      //Unit: seconds
+      void runUntil(double endTime){
+         runSites(endTime, false);
+      }
+
+      //Function outputs post simulation results of every site. Called once after the last runUntil()
+      void endSimulation(){
+         for(int siteIter = 0; siteIter < siteVector.size(); siteIter++){
+            siteVector[siteIter]->endSimulation();
+         }
+      }
+
+   private:
+      //Function runs sites on worker threads. Each worker takes the next site not yet run, so sites with more targets in view do not
+      //hold up the others. Target table is read-only while workers run
+      //Inputs: endTime = time sites run until (seconds). toSimLength = run each site to its own simulation length instead
+      void runSites(double endTime, bool toSimLength){
+         int threads = threadCount;
+         if(threads <= 0){
+            threads = thread::hardware_concurrency();
+         }
+         threads = max(1, min(threads, (int)siteVector.size()));
+
+         atomic<int> nextSite(0);
+         vector<thread> workers;
+         for(int threadIter = 0; threadIter < threads; threadIter++){
+            workers.push_back(thread(runWorker, this, &nextSite, endTime, toSimLength));
+         }
+         for(int threadIter = 0; threadIter < workers.size(); threadIter++){
+            workers[threadIter].join();
+         }
+      }
+
+      //Worker thread of runSites()
+      static void runWorker(radarNetwork* network, atomic<int>* nextSite, double endTime, bool toSimLength){
+         for(int siteIter = nextSite->fetch_add(1); siteIter < network->siteVector.size(); siteIter = nextSite->fetch_add(1)){
+            radar* site = network->siteVector[siteIter];
+            if(toSimLength == true){
+               while(site->getTime() <= site->getSimLength()){ //Same loop condition as radar::startSimulation()
+                  site->stepFrame();
+               }
+            }
+            else{
+               while(site->getTime() < endTime){
+                  site->stepFrame();
+               }
+            }
+         }
+      }
+
+      //Gets seed of a site's random draws
+      uint64_t siteSeed(int siteIter){
+         return randomSeed + siteIter*0x9E3779B97F4A7C15ULL;
+      }
+
+      vector<radar*> siteVector;       //Contains all radar sites of network
+      vector<target*> targetVector;    //Shared target table observed by every site
+      int nextTargetID;                //ID given to next added target
+      int threadCount;                 //Amount of threads sites are simulated on (0 = hardware cores)
+      uint64_t randomSeed;             //Network seed random draws of every site are derived from
+};
+
+#endif
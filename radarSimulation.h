@@ -0,0 +1,141 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: radarSimulation.h contains the step-wise simulation interface used to embed the radar model inside a
+ *              larger simulation loop. A radarSimulation is constructed from an in-memory scenario (scenario.h), is
+ *              advanced with step()/runUntil(), and targets can be injected or removed between steps. Search detections
+ *              and track events are pulled through callbacks or written directly into caller-owned buffers
+ *              (simulationRecords.h). The radar is advanced in whole simulation frames (scenario refreshRate), so
+ *              step()/runUntil() stop on the first frame boundary at or after the requested time.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef RADARSIMULATION_H
+#define RADARSIMULATION_H
+#include "configManager.h"
+#include "scenario.h"
+#include "simulationRecords.h"
+#include <vector>
+
+using namespace std;
+
+class radarSimulation {
+   public:
+      radarSimulation(const scenario &sim){
+         config.initializeScenarioData(sim, simRadar);
+         simRadar.setConsoleOutput(false);         //Embedded radar does not print to console
+         simRadar.setStoreSearchHistory(false);    //Detections are consumed through callbacks/buffers, memory stays constant
+         simRadar.beginSimulation();
+         ended = false;
+      }
+      ~radarSimulation(){
+         finish();
+         //Simulation owns all targets created from the scenario or injected. Faces and sectors are owned by config's tables
+         const vector<target*> &targetVector = simRadar.getTargetVector();
+         for(int targetIter = 0; targetIter < targetVector.size(); targetIter++){
+            delete targetVector[targetIter];
+         }
+      }
+
+//////////////////////////////////////////////////////////////////////////////////////
+//Simulation control
+
+      //Advances simulation by at least deltaTime
+      //Unit: seconds
+      void step(double deltaTime){
+         runUntil(simRadar.getTime() + deltaTime);
+      }
+
+      //Advances simulation frame by frame until simulation time reaches endTime
+      //Unit: seconds
+      void runUntil(double endTime){
+         while(simRadar.getTime() < endTime){
+            simRadar.stepFrame();
+         }
+      }
+
+      //Ends simulation (plots, pacing, coverage and summary outputs of radar.h endSimulation). Called by destructor when
+      //not called by the caller, only the first call has an effect. No more steps may be taken afterwards
+      void finish(){
+         if(!ended){
+            ended = true;
+            simRadar.endSimulation();
+         }
+      }
+
+      //Gets current simulation time
+      //Unit: seconds
+      double getTime(){
+         return simRadar.getTime();
+      }
+
+      //Adds a new target to simulation at current simulation time. Must be called between steps. Parameters use TargetInfo.txt units
+      //Returns target handle used to remove target
+      target* injectTarget(const targetParams &params){
+         target* radarTarget = new target;
+         config.initializeTargetParams(*radarTarget, params);
+         radarTarget->setStartTime(simRadar.getTime()); //Starting position/velocity refer to time of injection
+         simRadar.addTarget(*radarTarget);
+         return radarTarget;
+      }
+
+      //Removes a target (and its tracking profile) from simulation. Must be called between steps
+      void removeTarget(target* radarTarget){
+         simRadar.removeTarget(radarTarget);
+         delete radarTarget;
+      }
+
+//////////////////////////////////////////////////////////////////////////////////////
+//Output related functions
+
+      //Sets function called on every search detection
+      void setDetectionCallback(searchDetectCallback callback, void* userData){
+         simRadar.setDetectionCallback(callback, userData);
+      }
+
+      //Sets function called on every track event
+      void setTrackEventCallback(trackEventCallback callback, void* userData){
+         simRadar.setTrackEventCallback(callback, userData);
+      }
+
+      //Sets caller-owned buffer search detections are written into. Empty it between steps with resetDetectionBuffer()
+      void setDetectionBuffer(searchDetectRecord* buffer, int capacity){
+         simRadar.setDetectionBuffer(buffer, capacity);
+      }
+
+      //Sets caller-owned buffer track events are written into. Empty it between steps with resetTrackEventBuffer()
+      void setTrackEventBuffer(trackEventRecord* buffer, int capacity){
+         simRadar.setTrackEventBuffer(buffer, capacity);
+      }
+
+      //Empties caller-owned detection buffer
+      void resetDetectionBuffer(){
+         simRadar.resetDetectionBuffer();
+      }
+
+      //Empties caller-owned track event buffer
+      void resetTrackEventBuffer(){
+         simRadar.resetTrackEventBuffer();
+      }
+
+      //Gets amount of detections written into caller-owned buffer since last reset
+      int getDetectionCount(){
+         return simRadar.getDetectionBufferCount();
+      }
+
+      //Gets amount of track events written into caller-owned buffer since last reset
+      int getTrackEventCount(){
+         return simRadar.getTrackEventBufferCount();
+      }
+
+      //Gets the underlying radar object, used for any radar.h setting not covered above
+      radar& getRadar(){
+         return simRadar;
+      }
+
+   private:
+      radar simRadar;         //Radar being simulated
+      configManager config;   //Used to assign scenario parameters to radar objects
+      bool ended;             //True once endSimulation() has been called
+};
+
+#endif
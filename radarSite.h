@@ -0,0 +1,121 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: radarSite.h contains the position and orientation of a radar site in the shared world frame. A site
+ *              computes its own view of a target (site relative cartesian and spherical position) on the fly from the
+ *              target's state at an absolute time, so a target is never modified by the radars observing it and one
+ *              target table can be shared by every site of a radar network (radarNetwork.h).
+ *              A site at the origin with a heading of 0 degrees gives the same coordinates as target::convertCoordXYZtoPolar.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef RADARSITE_H
+#define RADARSITE_H
+#include "target.h"
+#include "utility.h"
+#include <math.h>
+
+using namespace std;
+
+//Target state seen from one radar site at one simulation time
+struct targetView {
+   double time;         //Simulation time of view. (seconds)
+   double xyz[3];       //Site relative cartesian position. 0 = x-position, 1 = y-position, 2 = z-position. (meters)
+   double polar[3];     //Site relative spherical position. 0 = azimuth position(deg), 1 = elevation position(deg), 2 = range(meters)
+};
+
+class radarSite {
+   public:
+      radarSite(){
+         for(int i = 0; i < 3; i++){
+            position[i] = 0;  //Sites are at the world origin by default
+         }
+         setHeading(0 * units::deg);
+      }
+      ~radarSite(){}
+
+//////////////////////////////////////////////////////////////////////////////////////
+//Setter and getter related functions
+
+      //Sets site position in world frame
+      void setPosition(lengthValue x, lengthValue y, lengthValue z){
+         position[0] = x / units::m;
+         position[1] = y / units::m;
+         position[2] = z / units::m;
+      }
+
+      //Gets site position in world frame
+      //Input: 0 = x-position, 1 = y-position, 2 = z-position
+      //Unit: meters
+      double getPosition(int iter){
+         return position[iter];
+      }
+
+      //Sets site heading, world azimuth the site's 0 degree azimuth points along (counter-clockwise, same sense as azimuth)
+      void setHeading(angleValue siteHeading){
+         heading = siteHeading / units::deg;
+         double radians = heading * (M_PI/180);
+         cosHeading = cos(radians);
+         sinHeading = sin(radians);
+      }
+
+      //Gets site heading
+      //Unit: degrees
+      double getHeading(){
+         return heading;
+      }
+//////////////////////////////////////////////////////////////////////////////////////
+
+      //Function computes site relative view of a target at an absolute simulation time. Target is only read
+      //Inputs: viewedTarget = target in world frame. time = simulation time (seconds). view = output view
+      void getView(target* viewedTarget, double time, targetView &view){
+         double worldXYZ[3];
+         double vel[3];
+         viewedTarget->getStateAt(time, worldXYZ, vel);
+         toSiteFrame(worldXYZ, view.xyz);
+         view.time = time;
+         for(int i = 0; i < 3; i++){
+            view.polar[i] = view.xyz[i];
+         }
+         utility::rectToPolarRads(view.polar);   //Converts cartesian coordinates to spherical radians
+         utility::radsToDeg(view.polar);         //Converts radians to degrees
+         view.polar[0] = fmod(view.polar[0]+360,360); //Converts negative values to positive and rids of possible 360degree overflow
+      }
+
+      //Function computes range from site to a target at an absolute simulation time (used by range culling)
+      //Units: seconds, output in meters
+      double getRange(target* viewedTarget, double time){
+         double worldXYZ[3];
+         double vel[3];
+         viewedTarget->getStateAt(time, worldXYZ, vel);
+         double dx = worldXYZ[0] - position[0];
+         double dy = worldXYZ[1] - position[1];
+         double dz = worldXYZ[2] - position[2];
+         return sqrt(pow(dx,2) + pow(dy,2) + pow(dz,2));
+      }
+
+      //Function converts a world frame position to site frame (translate to site, then rotate by -heading about z)
+      //Unit: meters
+      void toSiteFrame(const double worldXYZ[3], double siteXYZ[3]){
+         double dx = worldXYZ[0] - position[0];
+         double dy = worldXYZ[1] - position[1];
+         siteXYZ[0] = cosHeading*dx + sinHeading*dy;
+         siteXYZ[1] = -sinHeading*dx + cosHeading*dy;
+         siteXYZ[2] = worldXYZ[2] - position[2];
+      }
+
+      //Function converts a site frame position to world frame
+      //Unit: meters
+      void toWorldFrame(const double siteXYZ[3], double worldXYZ[3]){
+         worldXYZ[0] = cosHeading*siteXYZ[0] - sinHeading*siteXYZ[1] + position[0];
+         worldXYZ[1] = sinHeading*siteXYZ[0] + cosHeading*siteXYZ[1] + position[1];
+         worldXYZ[2] = siteXYZ[2] + position[2];
+      }
+
+   private:
+      double position[3];  //Site position in world frame. 0 = x-position, 1 = y-position, 2 = z-position. (meters)
+      double heading;      //World azimuth of site's 0 degree azimuth. (degrees)
+      double cosHeading;   //Cosine of heading, cached for frame rotations
+      double sinHeading;   //Sine of heading, cached for frame rotations
+};
+
+#endif
@@ -0,0 +1,115 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: rangeCulling.h contains a range-sorted index of all targets used to skip targets a search sector cannot
+ *              detect. Each search sector has a maximum detectable range (inverse radar range equation solved for the
+ *              largest RCS present, limited by the sector's range extent). The index is built at the start of a
+ *              face's interval frame with each target's range and an upper bound on how far the target can move during
+ *              the frame, so a range query returns every target that could be inside [minimum, maximum] range at any
+ *              time within the frame. Targets outside are skipped cheaply and are re-admitted automatically once a later
+ *              build finds their range has shrunk. Faces whose interval frame lies inside the index window share one build.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef RANGECULLING_H
+#define RANGECULLING_H
+#include "target.h"
+#include "radarSite.h"
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+//Single target entry of range index
+struct rangeEntry {
+   double range;           //Target range at time index was built. (meters)
+   double maxDisplacement; //Largest distance target can travel during index window. (meters)
+   int targetIter;         //Target's position in radar's targetVector
+};
+
+class rangeCullIndex {
+   public:
+      rangeCullIndex(){
+         buildTime = 0;
+         window = 0;
+         maxDisplacement = 0;
+      }
+      ~rangeCullIndex(){}
+
+      //Function builds index from all targets existing at time. Ranges are measured from site, targets are only read
+      //Inputs: targets = radar's targetVector. site = observing radar site. time = index start time. windowLength = length of time index is valid for
+      //Units: seconds
+      void build(vector<target*> &targets, radarSite &site, double time, double windowLength){
+         entries.clear();
+         buildTime = time;
+         window = windowLength;
+         maxDisplacement = 0;
+         for(int targetIter = 0; targetIter < targets.size(); targetIter++){
+            if(targets[targetIter]->isActiveDuring(time, windowLength) == false){
+               continue; //Target does not exist at any time within window
+            }
+            rangeEntry entry;
+            entry.range = site.getRange(targets[targetIter], time);
+            entry.maxDisplacement = targets[targetIter]->getMaxDisplacement(time, windowLength);
+            entry.targetIter = targetIter;
+            maxDisplacement = max(maxDisplacement, entry.maxDisplacement);
+            entries.push_back(entry);
+         }
+         sort(entries.begin(), entries.end(), compareRange);
+      }
+
+      //Function determines if index is still valid at time
+      //Unit: seconds
+      bool isValidAt(double time){
+         return time <= buildTime + window;
+      }
+
+      //Function determines if index window contains the window of windowLength starting at time, so it can be used again
+      //Units: seconds
+      bool covers(double time, double windowLength){
+         return entries.empty() == false && buildTime <= time && time + windowLength <= buildTime + window;
+      }
+
+      //Function exchanges contents with another index (index built ahead of time by a pipelined simulation's truth stage)
+      void swap(rangeCullIndex &other){
+         entries.swap(other.entries);
+         std::swap(buildTime, other.buildTime);
+         std::swap(window, other.window);
+         std::swap(maxDisplacement, other.maxDisplacement);
+      }
+
+      //Function gathers every target which could be within [minRange, maxRange] during index window. Found targets are
+      //returned in targetVector order, so detections are made in the same order as without culling
+      //Units: meters
+      void query(double minRange, double maxRange, vector<int> &found){
+         found.clear();
+         //Binary searching for first entry that could reach minimum range
+         rangeEntry bound;
+         bound.range = minRange - maxDisplacement;
+         vector<rangeEntry>::iterator iter = lower_bound(entries.begin(), entries.end(), bound, compareRange);
+         for(; iter != entries.end() && iter->range <= maxRange + maxDisplacement; ++iter){
+            //Per target check using target's own displacement bound
+            if(iter->range + iter->maxDisplacement >= minRange && iter->range - iter->maxDisplacement <= maxRange){
+               found.push_back(iter->targetIter);
+            }
+         }
+         sort(found.begin(), found.end());
+      }
+
+      //Gets amount of targets in index
+      int getSize(){
+         return entries.size();
+      }
+
+   private:
+      //Sorting criteria for range entries
+      static bool compareRange(const rangeEntry &first, const rangeEntry &second){
+         return first.range < second.range;
+      }
+
+      vector<rangeEntry> entries;   //All indexed targets sorted by range
+      double buildTime;             //Time index was built. (seconds)
+      double window;                //Length of time index is valid for. (seconds)
+      double maxDisplacement;       //Largest displacement bound of all indexed targets. (meters)
+};
+
+#endif
@@ -0,0 +1,275 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: realTimePacer.h contains the logic used to run the simulation in step with the wall clock. Each simulation
+ *              frame is computed one frame ahead of the wall clock, its detection and track events are buffered, and each
+ *              event is then released once a monotonic (steady) clock reaches the event's simulated time. The class
+ *              records deadline misses (frames finished after their start time had already passed) and a histogram
+ *              of emit latency (how late each event was released compared to its scheduled wall time). When a frame
+ *              overruns by more than the allowed lag, the pacer re-anchors the schedule to the current wall time
+ *              instead of bursting through the backlog.
+ *              Events are released by an emitter thread owned by the pacer, so the simulation thread computes the next
+ *              frame while the current frame's events are released, and the wait for them is never counted against
+ *              the next frame's deadline. Emit metrics are complete once finish() returns.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef REALTIMEPACER_H
+#define REALTIMEPACER_H
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iostream>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+using namespace std;
+
+//Single buffered output event waiting for its wall clock deadline
+struct realTimeEvent {
+   double simTime;                              //Simulated time the event occured. (seconds)
+   string text;                                 //Text line emitted once the event is released
+   chrono::steady_clock::time_point deadline;   //Wall clock time event is released at, set when its frame is emitted
+};
+
+class realTimePacer {
+   public:
+      realTimePacer(){
+         enabled = false;        //Real-time mode is optional, simulation runs as fast as possible by default
+         speedFactor = 1;        //1 simulated second per wall second
+         maxLag = 1;             //Maximum allowed lag before schedule is re-anchored. (seconds)
+         output = &cout;
+         emitterRunning = false;
+         stopEmitter = false;
+         resetMetrics();
+      }
+      ~realTimePacer(){
+         finish();
+      }
+      realTimePacer(const realTimePacer&) = delete;
+      realTimePacer& operator=(const realTimePacer&) = delete;
+
+//////////////////////////////////////////////////////////////////////////////////////
+//Setter and getter related functions
+
+      //Enables real-time mode
+      //Input: speed = simulated seconds per wall clock second (1 = real-time, 2 = twice as fast)
+      void enable(double speed){
+         enabled = true;
+         speedFactor = speed;
+         if(speedFactor <= 0){
+            cout << "Error, real-time speed factor must be positive" << endl;
+            exit(1);
+         }
+      }
+
+      //Gets bool determining if real-time mode is enabled
+      bool isEnabled(){
+         return enabled;
+      }
+
+      //Sets the maximum lag behind the wall clock before the schedule is re-anchored
+      //Unit: seconds (wall clock)
+      void setMaxLag(double seconds){
+         maxLag = seconds;
+      }
+
+      //Sets stream events are emitted to (default is console)
+      void setOutputStream(ostream &stream){
+         output = &stream;
+      }
+
+      //Gets amount of frames which were finished after their start deadline
+      long getDeadlineMisses(){
+         return deadlineMisses;
+      }
+
+      //Gets amount of times the schedule was re-anchored due to an overrun
+      long getResyncs(){
+         return resyncs;
+      }
+
+      //Gets amount of events emitted (complete once finish() returned)
+      long getEventsEmitted(){
+         return eventsEmitted;
+      }
+////////////////////////////////////////////////////////////////////////////////////////
+
+      //Anchors simulated time to the wall clock and starts emitter thread. Called once before the first frame. The schedule starts
+      //one frame length from now, giving the first frame one frame of wall time to be computed in.
+      //Inputs: simTime = simulated start time. frameLength = simulated length of a frame
+      //Unit: seconds
+      void start(double simTime, double frameLength){
+         finish();
+         chrono::duration<double> lead(frameLength / speedFactor);
+         anchorWall = chrono::steady_clock::now() + chrono::duration_cast<chrono::steady_clock::duration>(lead);
+         anchorSim = simTime;
+         resetMetrics();
+         stopEmitter = false;
+         emitterRunning = true;
+         emitter = thread(runEmitter, this);
+      }
+
+      //Function waits for emitter thread to release every event handed to it, then stops it. Called once after the last frame
+      void finish(){
+         if(emitterRunning == false){
+            return;
+         }
+         {
+            lock_guard<mutex> lock(releaseLock);
+            stopEmitter = true;
+         }
+         releaseReady.notify_one();
+         emitter.join();
+         emitterRunning = false;
+      }
+
+      //Buffers an event until its frame is emitted
+      //Unit: seconds
+      void queueEvent(double simTime, const string &text){
+         realTimeEvent event;
+         event.simTime = simTime;
+         event.text = text;
+         pending.push_back(event);
+      }
+
+      //Function is called once the frame starting at frameStart has been computed. Hands all buffered events of the frame, in time order,
+      //to the emitter thread which releases each once the wall clock reaches it, then holds until frameStart so the simulation never runs
+      //more than one frame ahead. The next frame is computed while this frame's events are released.
+      //Units: seconds
+      void emitFrame(double frameStart){
+         framesPaced = framesPaced + 1;
+
+         //Determining if frame finished after its start deadline (events will be late)
+         double lateness = chrono::duration<double>(chrono::steady_clock::now() - wallDeadline(frameStart)).count();
+         if(lateness > 0){
+            deadlineMisses = deadlineMisses + 1;
+            //Frame overran by more than the allowed lag, schedule is re-anchored so backlog is dropped rather than emitted in a burst
+            if(lateness > maxLag){
+               anchorWall = chrono::steady_clock::now();
+               anchorSim = frameStart;
+               resyncs = resyncs + 1;
+            }
+         }
+
+         //Handing events to emitter thread in time order, deadlines are taken from the schedule as anchored now
+         stable_sort(pending.begin(), pending.end(), compareEventTime);
+         if(pending.empty() == false){
+            lock_guard<mutex> lock(releaseLock);
+            for(size_t iter = 0; iter < pending.size(); iter++){
+               pending[iter].deadline = wallDeadline(pending[iter].simTime);
+               releaseQueue.push_back(move(pending[iter]));
+            }
+         }
+         releaseReady.notify_one();
+         pending.clear();
+
+         //Holding until frame start so next frame is computed at most one frame ahead of the wall clock
+         this_thread::sleep_until(wallDeadline(frameStart));
+      }
+
+      //Function displays real-time metrics (deadline misses and emit-latency histogram) to user's console. Call after finish()
+      void printReport(){
+         cout << "Real-time frames paced: " << framesPaced << endl;
+         cout << "Deadline misses: " << deadlineMisses << " (" << resyncs << " resync(s))" << endl;
+         cout << "Events emitted: " << eventsEmitted << endl;
+         if(eventsEmitted > 0){
+            cout << "Emit latency mean= (" << latencySumUs/eventsEmitted << ")us, max= (" << latencyMaxUs << ")us" << endl;
+         }
+         //Each bucket holds latencies within [2^(n-1), 2^n) microseconds, bucket 0 holds latencies below 1 microsecond
+         for(int bucket = 0; bucket < LATENCY_BUCKETS; bucket++){
+            if(latencyHistogram[bucket] == 0){
+               continue;
+            }
+            long lower = (bucket == 0) ? 0 : (1L << (bucket-1));
+            cout << "   [" << lower << "," << (1L << bucket) << ")us: " << latencyHistogram[bucket] << endl;
+         }
+      }
+
+   private:
+      static const int LATENCY_BUCKETS = 28; //Log2 buckets covering up to ~134 seconds of latency
+
+      //Emitter thread, releases handed events once the wall clock reaches them until finish() and every event was released
+      static void runEmitter(realTimePacer* pacer){
+         realTimeEvent event;
+         while(true){
+            {
+               unique_lock<mutex> lock(pacer->releaseLock);
+               pacer->releaseReady.wait(lock, [pacer]{ return pacer->releaseQueue.empty() == false || pacer->stopEmitter == true; });
+               if(pacer->releaseQueue.empty() == true){
+                  return;
+               }
+               event = move(pacer->releaseQueue.front());
+               pacer->releaseQueue.pop_front();
+            }
+            this_thread::sleep_until(event.deadline);
+            *pacer->output << event.text << endl;
+            pacer->recordLatency(chrono::steady_clock::now() - event.deadline);
+         }
+      }
+
+      //Gets wall clock time a simulated time is scheduled to be emitted at
+      chrono::steady_clock::time_point wallDeadline(double simTime){
+         chrono::duration<double> offset((simTime - anchorSim) / speedFactor);
+         return anchorWall + chrono::duration_cast<chrono::steady_clock::duration>(offset);
+      }
+
+      //Adds an emitted event's latency to histogram
+      void recordLatency(chrono::steady_clock::duration latency){
+         long latencyUs = chrono::duration_cast<chrono::microseconds>(latency).count();
+         if(latencyUs < 0){
+            latencyUs = 0;
+         }
+         int bucket = 0;
+         while(bucket < LATENCY_BUCKETS-1 && latencyUs >= (1L << bucket)){
+            bucket = bucket + 1;
+         }
+         latencyHistogram[bucket] = latencyHistogram[bucket] + 1;
+         latencySumUs = latencySumUs + latencyUs;
+         latencyMaxUs = max(latencyMaxUs, latencyUs);
+         eventsEmitted = eventsEmitted + 1;
+      }
+
+      //Resets all real-time counters
+      void resetMetrics(){
+         framesPaced = 0;
+         deadlineMisses = 0;
+         resyncs = 0;
+         eventsEmitted = 0;
+         latencySumUs = 0;
+         latencyMaxUs = 0;
+         for(int bucket = 0; bucket < LATENCY_BUCKETS; bucket++){
+            latencyHistogram[bucket] = 0;
+         }
+      }
+
+      //Sorting criteria for buffered events
+      static bool compareEventTime(const realTimeEvent &first, const realTimeEvent &second){
+         return first.simTime < second.simTime;
+      }
+
+      bool enabled;                                //Determines if simulation is paced against wall clock
+      double speedFactor;                          //Simulated seconds per wall clock second. (unitless)
+      double maxLag;                               //Lag behind wall clock that triggers schedule re-anchoring. (seconds)
+      ostream* output;                             //Stream events are emitted to
+      chrono::steady_clock::time_point anchorWall; //Wall clock time matching anchorSim
+      double anchorSim;                            //Simulated time matching anchorWall. (seconds)
+      vector<realTimeEvent> pending;               //Events of current frame waiting to be released
+      deque<realTimeEvent> releaseQueue;           //Events handed to emitter thread, in release order
+      mutex releaseLock;                           //Guards releaseQueue and stopEmitter
+      condition_variable releaseReady;             //Signals emitter thread of new events or finish()
+      thread emitter;                              //Emitter thread, releases events at their deadlines
+      bool emitterRunning;                         //Emitter thread was started and not finished
+      bool stopEmitter;                            //Emitter thread returns once releaseQueue is empty
+      long framesPaced;                            //Amount of frames emitted in real-time mode
+      long deadlineMisses;                         //Amount of frames finished after their start deadline
+      long resyncs;                                //Amount of times schedule was re-anchored
+      long eventsEmitted;                          //Amount of events released
+      long latencySumUs;                           //Sum of all emit latencies. (microseconds)
+      long latencyMaxUs;                           //Largest emit latency. (microseconds)
+      long latencyHistogram[LATENCY_BUCKETS];      //Log2 histogram of emit latency. (microseconds)
+};
+
+#endif
@@ -0,0 +1,478 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: scalingStudy.cpp measures how the whole simulator scales, for capacity planning. It runs full simulations
+ *              (radar::startSimulation(), or shardedSimulation.h with more than one worker) over a matrix of target
+ *              counts, face/sector counts, tracked target counts and worker counts, and reports for every run:
+ *                 simulated seconds per wall second, search beams (dwells) per wall second, peak resident memory and
+ *                 parallel efficiency (throughput over worker count times single worker throughput of the same scenario).
+ *              Scenarios are generated in memory (scenario.h) from a fixed seed: faces split 360 degrees of azimuth,
+ *              sectors split their face's azimuth extent. "tracks" targets fly inside search coverage and are detected
+ *              and tracked, the remaining targets fly beyond the sectors' range extent (propagated and range culled only).
+ *              Every run uses the decoupled beam timeline, so the same scenario does the same work whatever the amount of
+ *              workers. Each run is made in its own child process, so peak memory is that of the run alone. Every
+ *              configuration is run --repeats times (default 3) and the fastest run is reported: other processes and the
+ *              host only ever slow a run down, so the fastest run is the least disturbed one. The default simulated length
+ *              keeps each run at a few hundred milliseconds or more; shorter runs are timer and scheduler noise and are
+ *              flagged.
+ *                 g++ -O2 -std=c++17 -pthread scalingStudy.cpp -o scalingStudy
+ *                 ./scalingStudy --targets 1000,4000 --workers 1,2,4 --csv scaling.csv --json scaling.json
+ *                 ./scalingStudy --targets 1000,4000 --workers 1,2,4 --baseline scaling.csv
+ *              With --baseline, runs are matched to a CSV report of an earlier study and a run is flagged as a regression
+ *              when its best throughput drops, or its peak memory grows, by more than the tolerance (default 10%). The
+ *              study then exits with status 2.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "configManager.h"
+#include "shardedSimulation.h"
+#include <stdio.h>
+#include <chrono>
+#include <random>
+#include <map>
+#include <thread>
+#include <sys/resource.h>
+
+using namespace std;
+
+//Study matrix and options
+struct studyOptions {
+   vector<int> targets;       //Target counts
+   vector<int> faces;         //Radar face counts
+   vector<int> sectors;       //Search sectors per face
+   vector<int> tracks;        //Targets inside search coverage
+   vector<int> workers;       //Worker processes
+   double simSeconds;         //Simulated time of each run. (seconds)
+   int repeats;               //Runs of each configuration, fastest run is reported
+   uint32_t seed;             //Scenario seed
+   string csvName;            //CSV report, empty = none
+   string jsonName;           //JSON report, empty = none
+   string baselineName;       //CSV report compared against, empty = none
+   double tolerance;          //Allowed relative throughput drop/memory growth before a run is flagged
+};
+
+//Single run of the study
+struct studyRun {
+   int targets;
+   int faces;
+   int sectors;
+   int tracks;
+   int workers;
+   double simSeconds;         //Simulated time reached. (seconds)
+   double wallSeconds;        //Wall clock time of simulation. (seconds)
+   uint64_t dwells;           //Search beams sent
+   long detections;           //Search detections
+   long trackStarts;          //Tracks started
+   long peakRssKB;            //Peak resident memory of run, largest of coordinator and worker processes. (kilobytes)
+   double simRate;            //Simulated seconds per wall second
+   double dwellRate;          //Search beams per wall second
+   double efficiency;         //Parallel efficiency, 1 = perfect scaling. 0 if no single worker run of scenario
+};
+
+//Counts records replayed through radar's callbacks
+void countDetection(const searchDetectRecord &, void* userData){
+   ((long*)userData)[0]++;
+}
+void countTrackEvent(const trackEventRecord &record, void* userData){
+   if(record.type == TRACK_STARTED){
+      ((long*)userData)[1]++;
+   }
+}
+
+//Function generates study scenario. Face and sector parameters are those of inputFiles/FaceInfo.txt
+scenario buildScenario(const studyRun &run, double simSeconds, uint32_t seed){
+   scenario sim;
+   sim.trackPRF = 2;
+   sim.trackingSNRmin = 0;
+   sim.trackBeamWidth[0] = 3;
+   sim.trackBeamWidth[1] = 3;
+   sim.filterWeights[0] = .3;
+   sim.filterWeights[1] = .4;
+   sim.filterWeights[2] = 1;
+   sim.refreshRate = 1;
+   sim.simLength = simSeconds/60;
+
+   double faceWidth = 360.0/run.faces;
+   for(int faceIter = 0; faceIter < run.faces; faceIter++){
+      faceParams face;
+      double azBegin = faceIter*faceWidth;
+      face.boresight[0] = azBegin + faceWidth/2;
+      face.boresight[1] = 45;
+      face.azExtent[0] = azBegin;
+      face.azExtent[1] = azBegin + faceWidth;
+      face.elExtent[0] = 0;
+      face.elExtent[1] = 90;
+      face.halfPowerBeamWidth[0] = 5;
+      face.halfPowerBeamWidth[1] = 5;
+      face.SNRmin = 0;
+      face.waveFreq = 90;
+      face.bandwidth = 30;
+      face.effectiveAttenaArea = 5;
+      face.peakPower = 150;
+      face.noiseFigure = 2.5;
+      face.totalSysLoss = 9;
+      double sectorWidth = faceWidth/run.sectors;
+      for(int sectorIter = 0; sectorIter < run.sectors; sectorIter++){
+         sectorParams sector;
+         sector.azExtent[0] = azBegin + sectorIter*sectorWidth;
+         sector.azExtent[1] = azBegin + (sectorIter + 1)*sectorWidth;
+         sector.elExtent[0] = 0;
+         sector.elExtent[1] = 90;
+         sector.rangeExtent[0] = 0;
+         sector.rangeExtent[1] = 200;
+         sector.refreshRate = 10;
+         face.sectors.push_back(sector);
+      }
+      sim.faces.push_back(face);
+   }
+
+   //Same targets for a scenario whatever the amount of workers
+   mt19937 generator(seed);
+   uniform_real_distribution<double> unit(0, 1);
+   for(int targetIter = 0; targetIter < run.targets; targetIter++){
+      targetParams target;
+      bool covered = targetIter < run.tracks;
+      double range = covered ? 20 + 100*unit(generator) : 260 + 140*unit(generator);   //kilometers
+      double azimuth = 2*M_PI*unit(generator);
+      target.coordXYZ[0] = range*cos(azimuth);
+      target.coordXYZ[1] = range*sin(azimuth);
+      target.coordXYZ[2] = 1 + 14*unit(generator);
+      double heading = 2*M_PI*unit(generator);
+      double speed = 50 + 200*unit(generator);
+      target.velocity[0] = speed*cos(heading);
+      target.velocity[1] = speed*sin(heading);
+      target.velocity[2] = 0;
+      for(int i = 0; i < 3; i++){
+         target.acceleration[i] = 0;
+      }
+      target.rcs = 10;
+      sim.targets.push_back(target);
+   }
+   return sim;
+}
+
+//Function runs one simulation of the study (called in its own child process)
+studyRun simulate(studyRun run, double simSeconds, uint32_t seed){
+   srand(seed);   //Starting scan positions
+   scenario sim = buildScenario(run, simSeconds, seed);
+   configManager config;
+   radar simRadar;
+   config.initializeScenarioData(sim, simRadar);
+   simRadar.setConsoleOutput(false);
+   simRadar.setStoreSearchHistory(false);
+   simRadar.setDecoupledTimeline(true);
+   long counts[2] = {0, 0};
+   simRadar.setDetectionCallback(countDetection, counts);
+   simRadar.setTrackEventCallback(countTrackEvent, counts);
+
+   chrono::steady_clock::time_point start = chrono::steady_clock::now();
+   if(run.workers <= 1){
+      simRadar.startSimulation();
+   }
+   else{
+      shardedSimulation sharded(simRadar, run.workers);
+      sharded.startSimulation();
+   }
+   chrono::steady_clock::time_point end = chrono::steady_clock::now();
+
+   struct rusage self;
+   struct rusage children;
+   getrusage(RUSAGE_SELF, &self);
+   getrusage(RUSAGE_CHILDREN, &children);
+   run.simSeconds = simRadar.getTime();
+   run.wallSeconds = chrono::duration<double>(end - start).count();
+   run.dwells = simRadar.getDwellCount();   //0 in a sharded coordinator, filled in from single worker run
+   run.detections = counts[0];
+   run.trackStarts = counts[1];
+   run.peakRssKB = max(self.ru_maxrss, children.ru_maxrss);
+   return run;
+}
+
+//Function runs a simulation in a child process and collects its results. Returns false if the run failed
+bool runIsolated(studyRun &run, double simSeconds, uint32_t seed){
+   int pipeEnds[2];
+   if(pipe(pipeEnds) != 0){
+      cout << "Error, could not create pipe" << endl;
+      exit(1);
+   }
+   cout.flush();
+   pid_t pid = fork();
+   if(pid < 0){
+      cout << "Error, could not start study run" << endl;
+      exit(1);
+   }
+   if(pid == 0){
+      close(pipeEnds[0]);
+      studyRun result = simulate(run, simSeconds, seed);
+      ssize_t written = write(pipeEnds[1], &result, sizeof(result));
+      _exit(written == sizeof(result) ? 0 : 1);
+   }
+   close(pipeEnds[1]);
+   studyRun result;
+   ssize_t received = read(pipeEnds[0], &result, sizeof(result));
+   close(pipeEnds[0]);
+   int status = 0;
+   waitpid(pid, &status, 0);
+   if(received != sizeof(result) || WIFEXITED(status) == false || WEXITSTATUS(status) != 0){
+      return false;
+   }
+   run = result;
+   return true;
+}
+
+//Function runs a configuration repeats times, each in its own child process, and keeps the fastest run. Returns false if a run failed
+bool runRepeated(studyRun &run, double simSeconds, uint32_t seed, int repeats){
+   studyRun fastest;
+   for(int repeatIter = 0; repeatIter < repeats; repeatIter++){
+      studyRun result = run;
+      if(runIsolated(result, simSeconds, seed) == false){
+         return false;
+      }
+      if(repeatIter == 0 || result.wallSeconds < fastest.wallSeconds){
+         fastest = result;
+      }
+   }
+   run = fastest;
+   return true;
+}
+
+//Key of a scenario (run without worker count)
+string scenarioKey(const studyRun &run){
+   char key[96];
+   snprintf(key, sizeof(key), "%d/%d/%d/%d", run.targets, run.faces, run.sectors, run.tracks);
+   return key;
+}
+
+//Key of a run
+string runKey(const studyRun &run){
+   char key[96];
+   snprintf(key, sizeof(key), "%s/%d", scenarioKey(run).c_str(), run.workers);
+   return key;
+}
+
+const double MIN_WALL_SECONDS = 0.1;   //Runs shorter than this are mostly timer/scheduler noise. (seconds)
+
+const char* CSV_HEADER = "targets,faces,sectors,tracks,workers,simSeconds,wallSeconds,simSecondsPerWallSecond,dwells,dwellsPerSecond,detections,trackStarts,peakRssKB,parallelEfficiency";
+
+//Function writes study runs as CSV
+void writeCSV(const string &fileName, const vector<studyRun> &runs){
+   FILE* file = fopen(fileName.c_str(), "w");
+   if(file == NULL){
+      cout << "Error, could not open " << fileName << endl;
+      exit(1);
+   }
+   fprintf(file, "%s\n", CSV_HEADER);
+   for(int runIter = 0; runIter < runs.size(); runIter++){
+      const studyRun &run = runs[runIter];
+      fprintf(file, "%d,%d,%d,%d,%d,%.3f,%.6f,%.6g,%llu,%.6g,%ld,%ld,%ld,%.4f\n", run.targets, run.faces, run.sectors, run.tracks, run.workers,
+              run.simSeconds, run.wallSeconds, run.simRate, (unsigned long long)run.dwells, run.dwellRate, run.detections, run.trackStarts,
+              run.peakRssKB, run.efficiency);
+   }
+   fclose(file);
+}
+
+//Function writes study runs as JSON
+void writeJSON(const string &fileName, const vector<studyRun> &runs, const studyOptions &options){
+   FILE* file = fopen(fileName.c_str(), "w");
+   if(file == NULL){
+      cout << "Error, could not open " << fileName << endl;
+      exit(1);
+   }
+   fprintf(file, "{\n  \"hardwareThreads\": %u,\n  \"seed\": %u,\n  \"simSeconds\": %.3f,\n  \"repeats\": %d,\n  \"runs\": [\n", thread::hardware_concurrency(), options.seed,
+           options.simSeconds, options.repeats);
+   for(int runIter = 0; runIter < runs.size(); runIter++){
+      const studyRun &run = runs[runIter];
+      fprintf(file, "    {\"targets\": %d, \"faces\": %d, \"sectors\": %d, \"tracks\": %d, \"workers\": %d, \"simSeconds\": %.3f, \"wallSeconds\": %.6f, "
+                    "\"simSecondsPerWallSecond\": %.6g, \"dwells\": %llu, \"dwellsPerSecond\": %.6g, \"detections\": %ld, \"trackStarts\": %ld, "
+                    "\"peakRssKB\": %ld, \"parallelEfficiency\": %.4f}%s\n", run.targets, run.faces, run.sectors, run.tracks, run.workers,
+              run.simSeconds, run.wallSeconds, run.simRate, (unsigned long long)run.dwells, run.dwellRate, run.detections, run.trackStarts,
+              run.peakRssKB, run.efficiency, (runIter + 1 < runs.size()) ? "," : "");
+   }
+   fprintf(file, "  ]\n}\n");
+   fclose(file);
+}
+
+//Function reads a CSV report written by writeCSV()
+bool readCSV(const string &fileName, map<string, studyRun> &runs){
+   FILE* file = fopen(fileName.c_str(), "r");
+   if(file == NULL){
+      cout << "Error, could not open " << fileName << endl;
+      return false;
+   }
+   char line[512];
+   if(fgets(line, sizeof(line), file) == NULL || strncmp(line, CSV_HEADER, strlen(CSV_HEADER)) != 0){
+      cout << "Error, " << fileName << " is not a scaling study report" << endl;
+      fclose(file);
+      return false;
+   }
+   while(fgets(line, sizeof(line), file) != NULL){
+      studyRun run;
+      unsigned long long dwells;
+      if(sscanf(line, "%d,%d,%d,%d,%d,%lf,%lf,%lf,%llu,%lf,%ld,%ld,%ld,%lf", &run.targets, &run.faces, &run.sectors, &run.tracks, &run.workers,
+                &run.simSeconds, &run.wallSeconds, &run.simRate, &dwells, &run.dwellRate, &run.detections, &run.trackStarts, &run.peakRssKB,
+                &run.efficiency) != 14){
+         cout << "Error, malformed line in " << fileName << endl;
+         fclose(file);
+         return false;
+      }
+      run.dwells = dwells;
+      runs[runKey(run)] = run;
+   }
+   fclose(file);
+   return true;
+}
+
+//Function compares runs against a baseline report. Returns amount of regressions
+int compareBaseline(const vector<studyRun> &runs, const studyOptions &options){
+   map<string, studyRun> baseline;
+   if(readCSV(options.baselineName, baseline) == false){
+      exit(1);
+   }
+   int regressions = 0;
+   cout << endl << "Compared against " << options.baselineName << " (tolerance " << options.tolerance*100 << "%):" << endl;
+   for(int runIter = 0; runIter < runs.size(); runIter++){
+      const studyRun &run = runs[runIter];
+      map<string, studyRun>::iterator found = baseline.find(runKey(run));
+      if(found == baseline.end()){
+         cout << "  " << runKey(run) << ": not in baseline" << endl;
+         continue;
+      }
+      const studyRun &base = found->second;
+      double rateChange = (base.simRate > 0) ? run.simRate/base.simRate - 1 : 0;
+      double memoryChange = (base.peakRssKB > 0) ? (double)run.peakRssKB/base.peakRssKB - 1 : 0;
+      string flags;
+      if(rateChange < -options.tolerance){
+         flags = flags + " THROUGHPUT REGRESSION";
+      }
+      if(memoryChange > options.tolerance){
+         flags = flags + " MEMORY REGRESSION";
+      }
+      if(run.detections != base.detections || run.trackStarts != base.trackStarts){
+         flags = flags + " (output changed)";
+      }
+      if(rateChange < -options.tolerance || memoryChange > options.tolerance){
+         regressions = regressions + 1;
+      }
+      printf("  %-22s throughput %+6.1f%%  peak memory %+6.1f%%%s\n", runKey(run).c_str(), 100*rateChange, 100*memoryChange, flags.c_str());
+   }
+   cout << regressions << " regression(s)" << endl;
+   return regressions;
+}
+
+//Function parses a comma separated list of counts
+vector<int> parseList(const char* text){
+   vector<int> values;
+   string list = text;
+   size_t start = 0;
+   while(start <= list.size()){
+      size_t end = list.find(',', start);
+      if(end == string::npos){
+         end = list.size();
+      }
+      int value = atoi(list.substr(start, end - start).c_str());
+      if(value < 0 || (value == 0 && list.substr(start, end - start) != "0")){
+         cout << "Error, invalid list " << text << endl;
+         exit(1);
+      }
+      values.push_back(value);
+      start = end + 1;
+   }
+   return values;
+}
+
+int main(int argc, char** argv){
+   studyOptions options;
+   options.targets = parseList("1000,4000");
+   options.faces = parseList("3");
+   options.sectors = parseList("3");
+   options.tracks = parseList("0,100");
+   options.workers = parseList("1,2,4");
+   options.simSeconds = 1800;   //Runs last a few hundred milliseconds or more, so throughput is not timer noise
+   options.repeats = 3;
+   options.seed = 1;
+   options.tolerance = 0.10;
+   for(int argIter = 1; argIter < argc; argIter++){
+      string option = argv[argIter];
+      if(argIter + 1 >= argc){
+         cout << "Usage: " << argv[0] << " [--targets N,..] [--faces N,..] [--sectors N,..] [--tracks N,..] [--workers N,..] [--sim-seconds S] [--repeats N]" << endl;
+         cout << "       [--seed N] [--csv report.csv] [--json report.json] [--baseline baseline.csv] [--tolerance fraction]" << endl;
+         return 1;
+      }
+      const char* value = argv[++argIter];
+      if(option == "--targets") options.targets = parseList(value);
+      else if(option == "--faces") options.faces = parseList(value);
+      else if(option == "--sectors") options.sectors = parseList(value);
+      else if(option == "--tracks") options.tracks = parseList(value);
+      else if(option == "--workers") options.workers = parseList(value);
+      else if(option == "--sim-seconds") options.simSeconds = atof(value);
+      else if(option == "--repeats") options.repeats = atoi(value);
+      else if(option == "--seed") options.seed = atoi(value);
+      else if(option == "--csv") options.csvName = value;
+      else if(option == "--json") options.jsonName = value;
+      else if(option == "--baseline") options.baselineName = value;
+      else if(option == "--tolerance") options.tolerance = atof(value);
+      else{
+         cout << "Error, unknown option " << option << endl;
+         return 1;
+      }
+   }
+
+   if(options.repeats < 1){
+      cout << "Error, study needs at least one repeat of each run" << endl;
+      return 1;
+   }
+
+   //Single worker run of every scenario is needed for parallel efficiency and search beam counts, run first
+   vector<int> workers;
+   workers.push_back(1);
+   for(int workerIter = 0; workerIter < options.workers.size(); workerIter++){
+      if(options.workers[workerIter] > 1){
+         workers.push_back(options.workers[workerIter]);
+      }
+   }
+
+   vector<studyRun> runs;
+   map<string, studyRun> singleWorker;
+   printf("%-8s %-6s %-8s %-7s %-8s %14s %14s %11s %10s\n", "targets", "faces", "sectors", "tracks", "workers", "sim s/wall s", "dwells/s", "peak MB", "efficiency");
+   for(int targetIter = 0; targetIter < options.targets.size(); targetIter++)
+   for(int faceIter = 0; faceIter < options.faces.size(); faceIter++)
+   for(int sectorIter = 0; sectorIter < options.sectors.size(); sectorIter++)
+   for(int trackIter = 0; trackIter < options.tracks.size(); trackIter++)
+   for(int workerIter = 0; workerIter < workers.size(); workerIter++){
+      studyRun run;
+      memset(&run, 0, sizeof(run));
+      run.targets = options.targets[targetIter];
+      run.faces = max(1, options.faces[faceIter]);
+      run.sectors = max(1, options.sectors[sectorIter]);
+      run.tracks = min(options.tracks[trackIter], run.targets);
+      run.workers = workers[workerIter];
+      if(runRepeated(run, options.simSeconds, options.seed, options.repeats) == false){
+         cout << "Error, study run " << runKey(run) << " failed" << endl;
+         return 1;
+      }
+      if(run.workers == 1){
+         singleWorker[scenarioKey(run)] = run;
+      }
+      const studyRun &single = singleWorker[scenarioKey(run)];
+      run.dwells = single.dwells;   //Decoupled timeline, search beams do not depend on worker count
+      run.simRate = (run.wallSeconds > 0) ? run.simSeconds/run.wallSeconds : 0;
+      run.dwellRate = (run.wallSeconds > 0) ? run.dwells/run.wallSeconds : 0;
+      double singleRate = (single.wallSeconds > 0) ? single.simSeconds/single.wallSeconds : 0;
+      run.efficiency = (singleRate > 0) ? run.simRate/(run.workers*singleRate) : 0;
+      runs.push_back(run);
+      printf("%-8d %-6d %-8d %-7d %-8d %14.2f %14.0f %11.1f %10.2f%s\n", run.targets, run.faces, run.sectors, run.tracks, run.workers,
+             run.simRate, run.dwellRate, run.peakRssKB/1024.0, run.efficiency, (run.wallSeconds < MIN_WALL_SECONDS) ? "  (short run, noisy)" : "");
+      fflush(stdout);
+   }
+
+   if(options.csvName != ""){
+      writeCSV(options.csvName, runs);
+   }
+   if(options.jsonName != ""){
+      writeJSON(options.jsonName, runs, options);
+   }
+   if(options.baselineName != "" && compareBaseline(runs, options) > 0){
+      return 2;
+   }
+   return 0;
+}
@@ -0,0 +1,64 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: scenario.h contains an in-memory description of a simulation. It holds the same parameters as the
+ *              RadarInfo.txt, FaceInfo.txt, SectorInfo.txt and TargetInfo.txt input files, in the same units, so a
+ *              simulation can be configured without any file round-trips (see configManager::initializeScenarioData
+ *              and radarSimulation.h).
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef SCENARIO_H
+#define SCENARIO_H
+#include <vector>
+
+using namespace std;
+
+//searchSector.h parameters (SectorInfo.txt)
+struct sectorParams {
+   double azExtent[2];     //Azimuth search extent. 0 = leftmost position. 1 = rightmost position. (degrees)
+   double elExtent[2];     //Elevation search extent. 0 = lowest position. 1 = highest position. (degrees)
+   double rangeExtent[2];  //Range search extent. 0 = minimum range. 1 = maximum range. (kilometers)
+   double refreshRate;     //Time to search entire sector. (seconds)
+   double falseAlarmPfa = 0;  //Probability of false alarm per range cell, 0 = no false alarms. (unitless)
+   double rangeCellSize = 150; //Range resolution cell size used for false alarms. (meters)
+};
+
+//radarFace.h parameters (FaceInfo.txt)
+struct faceParams {
+   double boresight[2];          //Boresight. 0 = azimuth. 1 = elevation. (degrees)
+   double azExtent[2];           //Azimuth FOV. 0 = leftmost position. 1 = rightmost position. (degrees)
+   double elExtent[2];           //Elevation FOV. 0 = lowest position. 1 = highest position. (degrees)
+   double halfPowerBeamWidth[2]; //Search beam 3dB beamwidth. 0 = azimuth. 1 = elevation. (degrees)
+   double SNRmin;                //Minimum detectable SNR. (decible)
+   double waveFreq;              //Wave frequency. (gigahertz)
+   double bandwidth;             //Wave bandwidth. (kilohertz)
+   double effectiveAttenaArea;   //Effective attena area. (meter^2)
+   double peakPower;             //Peak power. (kilowatts)
+   double noiseFigure;           //Noise figure. (decible)
+   double totalSysLoss;          //Total system loss. (decible)
+   vector<sectorParams> sectors; //Search sectors of face
+};
+
+//target.h parameters (TargetInfo.txt)
+struct targetParams {
+   double coordXYZ[3];        //Starting position. 0 = x. 1 = y. 2 = z. (kilometers)
+   double velocity[3];        //Velocity. 0 = x. 1 = y. 2 = z. (m/s)
+   double acceleration[3];    //Acceleration. 0 = x. 1 = y. 2 = z. (m/s^2)
+   double rcs;                //Radar-Cross-Section. (dBm^2)
+};
+
+//radar.h parameters (RadarInfo.txt) along with every face and target of the simulation
+struct scenario {
+   double trackPRF;              //Tracking PRF. (kilohertz)
+   double trackingSNRmin;        //Minimum SNR for track detection. (decible)
+   double trackBeamWidth[2];     //Track beam 3dB beamwidth. 0 = azimuth. 1 = elevation. (degrees)
+   double filterWeights[3];      //Alpha-beta-gamma weights. 0 = alpha. 1 = beta. 2 = gamma. (unitless)
+   double refreshRate;           //Simulation frame length. (seconds)
+   double simLength;             //Simulation run time. (minutes)
+   double sitePosition[3] = {0, 0, 0}; //Radar site position. 0 = x. 1 = y. 2 = z. (kilometers)
+   double siteHeading = 0;       //World azimuth of radar's 0 degree azimuth. (degrees)
+   vector<faceParams> faces;     //Radar faces
+   vector<targetParams> targets; //Targets
+};
+
+#endif
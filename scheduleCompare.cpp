@@ -0,0 +1,178 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: scheduleCompare.cpp checks that range culling (rangeCulling.h) and illumination scheduling
+ *              (illuminationSchedule.h) never change a simulation. Both only skip targets using a bound on how far a target
+ *              can move during a frame, so the check plays back recorded trajectories that are hard to bound: zig-zag
+ *              tracks whose Hermite spline overshoots its waypoints and turns faster than any recorded speed, and short
+ *              tracks that exist only in the middle of a frame. The inputFiles scenario plus these tracks is run with
+ *              culling and scheduling off, then on, and every search detection and track event is compared in order.
+ *                 g++ -O2 -std=c++17 -pthread scheduleCompare.cpp -o scheduleCompare
+ *                 ./scheduleCompare [tracks] [minutes] [pipelined]
+ *              Adding "pipelined" runs the culled/scheduled run pipelined (simulationPipeline.h), whose truth stage bounds
+ *              targets over longer windows ahead of time.
+ *              Returns 0 if both runs match, 1 otherwise.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "configManager.h"
+#include <stdio.h>
+
+using namespace std;
+
+//Single search detection or track event of a run
+struct compareRecord {
+   char kind;        //'D' = search detection. 'T' = track event
+   int type;         //trackEventType of track event
+   int faceIter;     //Radar face of detection
+   int sectorIter;   //Search sector of detection
+   int targetID;     //Truth target
+   double time;      //Search beam time, or track event time. (seconds)
+   double snr;       //Received SNR of detection. (decible)
+};
+
+//Stores search detections of a run
+void storeDetection(const searchDetectRecord &record, void* userData){
+   compareRecord entry;
+   entry.kind = 'D';
+   entry.type = 0;
+   entry.faceIter = record.faceIter;
+   entry.sectorIter = record.sectorIter;
+   entry.targetID = (record.detectedTarget != NULL) ? record.detectedTarget->getTargetID() : -1;
+   entry.time = record.dwellTime;
+   entry.snr = record.snr;
+   ((vector<compareRecord>*)userData)->push_back(entry);
+}
+
+//Stores track events of a run
+void storeTrackEvent(const trackEventRecord &record, void* userData){
+   compareRecord entry;
+   entry.kind = 'T';
+   entry.type = (int)record.type;
+   entry.faceIter = 0;
+   entry.sectorIter = 0;
+   entry.targetID = record.trackedTarget->getTargetID();
+   entry.time = record.time;
+   entry.snr = 0;
+   ((vector<compareRecord>*)userData)->push_back(entry);
+}
+
+//Writes waypoint file of hard to bound tracks around the site
+void writeTrajectories(const char* fileName, int trackCount){
+   vector< vector<waypoint> > tracks;
+   vector<double> rcs;
+   srand(5);
+   for(int track = 0; track < trackCount; track++){
+      double azimuth = 2*M_PI*(rand() % 3600)/3600.0;
+      double range = 20000 + rand() % 130000;
+      double altitude = 1000 + rand() % 14000;
+      double heading = 2*M_PI*(rand() % 3600)/3600.0;
+      double forward[3] = {cos(heading), sin(heading), 0};
+      double lateral[3] = {-sin(heading), cos(heading), 0};
+      vector<waypoint> points;
+      if(track % 10 == 9){
+         //Short track, exists for half a second somewhere inside a frame
+         double start = (rand() % 30000)/100.0 + 0.25;
+         for(int pointIter = 0; pointIter < 2; pointIter++){
+            waypoint point;
+            point.time = start + 0.5*pointIter;
+            for(int i = 0; i < 3; i++){
+               point.vel[i] = 300*forward[i];
+            }
+            point.xyz[0] = range*cos(azimuth) + 150*pointIter*forward[0];
+            point.xyz[1] = range*sin(azimuth) + 150*pointIter*forward[1];
+            point.xyz[2] = altitude;
+            points.push_back(point);
+         }
+      }
+      else{
+         //Zig-zag of +-amplitude every segment. Every waypoint's lateral velocity has the same sign, so on every other segment the
+         //spline moves against it and reaches twice the chord speed mid segment, and overshoots the waypoints
+         double segment = 2 + rand() % 3;
+         double amplitude = 2000 + rand() % 4000;
+         double chordSpeed = 2*amplitude/segment;
+         for(int pointIter = 0; segment*pointIter <= 60*60; pointIter++){
+            waypoint point;
+            point.time = segment*pointIter;
+            double side = (pointIter % 2 == 0) ? amplitude : -amplitude;
+            for(int i = 0; i < 3; i++){
+               point.xyz[i] = 250*point.time*forward[i] + side*lateral[i];
+               point.vel[i] = 250*forward[i] + chordSpeed*lateral[i];
+            }
+            point.xyz[0] = point.xyz[0] + range*cos(azimuth);
+            point.xyz[1] = point.xyz[1] + range*sin(azimuth);
+            point.xyz[2] = altitude;
+            points.push_back(point);
+         }
+      }
+      tracks.push_back(points);
+      rcs.push_back(10);
+   }
+   waypointFile::writeFile(fileName, tracks, rcs);
+}
+
+//Runs inputFiles scenario plus recorded tracks and stores every record
+void runScenario(const char* trajectoryName, double minutes, bool bounded, bool pipelined, vector<compareRecord> &records){
+   srand(1);   //Fixed starting scan positions, same in both runs
+   configManager config;
+   config.inputRadarFile("inputFiles/RadarInfo.txt");
+   config.inputFaceFile("inputFiles/FaceInfo.txt");
+   config.inputSectorFile("inputFiles/SectorInfo.txt");
+   config.inputTargetFile("inputFiles/TargetInfo.txt");
+   config.inputTrajectoryFile(trajectoryName);
+
+   radar simRadar;
+   config.initializeInputData(simRadar);
+   simRadar.setSimLength(minutes * units::min);
+   simRadar.setConsoleOutput(false);
+   simRadar.setStoreSearchHistory(false);
+   simRadar.setRangeCulling(bounded);
+   simRadar.setIlluminationScheduling(bounded);
+   simRadar.setPipelinedExecution(pipelined);
+   simRadar.setDetectionCallback(storeDetection, &records);
+   simRadar.setTrackEventCallback(storeTrackEvent, &records);
+   simRadar.startSimulation();
+   config.closeInputFiles();
+}
+
+int main(int argc, char** argv){
+   int trackCount = (argc > 1) ? atoi(argv[1]) : 500;
+   double minutes = (argc > 2) ? atof(argv[2]) : 5;
+   bool pipelined = (argc > 3 && string(argv[3]) == "pipelined");
+   const char* trajectoryName = "scheduleCompare.wpt";
+   writeTrajectories(trajectoryName, trackCount);
+
+   vector<compareRecord> exact;
+   vector<compareRecord> bounded;
+   runScenario(trajectoryName, minutes, false, false, exact);
+   runScenario(trajectoryName, minutes, true, pipelined, bounded);
+   remove(trajectoryName);
+
+   int detections = 0;
+   for(int recordIter = 0; recordIter < exact.size(); recordIter++){
+      if(exact[recordIter].kind == 'D'){
+         detections = detections + 1;
+      }
+   }
+   cout << "Culling/scheduling off: " << exact.size() << " records (" << detections << " detections)" << endl;
+   cout << "Culling/scheduling on:  " << bounded.size() << " records" << endl;
+
+   //First record where runs differ, every later record is shifted by it
+   int shared = min(exact.size(), bounded.size());
+   for(int recordIter = 0; recordIter < shared; recordIter++){
+      const compareRecord &first = exact[recordIter];
+      const compareRecord &second = bounded[recordIter];
+      if(first.kind != second.kind || first.type != second.type || first.faceIter != second.faceIter || first.sectorIter != second.sectorIter ||
+         first.targetID != second.targetID || first.time != second.time || first.snr != second.snr){
+         printf("Runs differ at record %d: off = %c target %d at %.6f s, on = %c target %d at %.6f s\n", recordIter,
+                first.kind, first.targetID, first.time, second.kind, second.targetID, second.time);
+         return 1;
+      }
+   }
+   if(exact.size() != bounded.size()){
+      cout << "Runs differ in amount of records" << endl;
+      return 1;
+   }
+   cout << "Runs match" << endl;
+   return 0;
+}
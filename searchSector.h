@@ -1,24 +1,30 @@
 /*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
  * Unclassified
  * Coder: Weston Yohe
- * Last Modified: 8/11/2022
+ * Last Modified: 10/19/2026
  * Description: searchSector.h contains the searching characteristics/parameters for a given radar face. A radar face 
  *              is capable of having many unique search sectors within a radar face's FOV (field-of-view) extent.
  *              Such characteristics include sectors searching FOV, time needed to search entire FOV, and the 
  *              current scanning position in azimuth and elevation. Currently all sectors are
  *              initialized to a random scanning position within their specific FOV, but increments scanning positions
- *              the same way.
+ *              the same way. Each sector also stores its search link budget constant and maximum detectable range,
+ *              used by radar.h to skip targets the sector cannot detect (rangeCulling.h). Optionally, a sector has a probability
+ *              of false alarm per range cell, used to generate false alarms of its search beams (falseAlarms.h).
  *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifndef SEARCHSECTOR_H
 #define SEARCHSECTOR_H
 #include "utility.h"
+#include "precision.h"
 #include <iostream>
 
 using namespace std;
 
 class searchSector {
    public:
-    searchSector(){}
+    searchSector(){
+        falseAlarmPfa = 0;      //No false alarms by default
+        rangeCellSize = 150;    //150 meter range resolution cells by default
+    }
     ~searchSector(){}
 
 ////////////////////////////////////////////////////////////////////////////////////
@@ -26,10 +32,9 @@ class searchSector {
 
     //Sets azimuth search extent and determines if the extent rolls over 360 degrees
     //Input: begin= "leftmost" azimuth position. end = "rightmost" azimuth position
-    //Unit: degrees
-    void setAzExtent(double begin, double end){
-            azExtent[0] = begin; //leftmost position
-            azExtent[1] = end;  //rightmost position
+    void setAzExtent(angleValue begin, angleValue end){
+            azExtent[0] = begin / units::deg; //leftmost position
+            azExtent[1] = end / units::deg;  //rightmost position
             if(azExtent[1]< azExtent[0]){
                 fovRollOver = true; //Search extent rolls over
             }
@@ -47,10 +52,9 @@ class searchSector {
 
     //Sets elevation search extent
     //Input: begin= lowest elevation position. end = highest elevation position
-    //Unit: degrees
-    void setElExtent(double begin, double end){
-        elExtent[0] = begin; //lowest position
-        elExtent[1] = end; //highest position
+    void setElExtent(angleValue begin, angleValue end){
+        elExtent[0] = begin / units::deg; //lowest position
+        elExtent[1] = end / units::deg; //highest position
     
     }
 
@@ -62,11 +66,9 @@ class searchSector {
     }
 
     //Sets search range minimum and maximum extent
-    //Units: kilometers
-    void setRangeExtent(double minKm, double maxKm){
-        //Converting from kilometers to meters
-        rangeExtent[0] = utility::kiloToBase(minKm);
-        rangeExtent[1] = utility::kiloToBase(maxKm);
+    void setRangeExtent(lengthValue minRange, lengthValue maxRange){
+        rangeExtent[0] = minRange / units::m;
+        rangeExtent[1] = maxRange / units::m;
     }
 
     //Gets range extent in either nearest or furthest position
@@ -78,9 +80,8 @@ class searchSector {
 
 
     //Sets refresh rate of search sector
-    //Units: seconds
-    void setRefreshRate(double time){
-        refreshRate = time;
+    void setRefreshRate(timeValue rate){
+        refreshRate = rate / units::s;
     }
 
     //Gets refresh rate of search sector
@@ -119,6 +120,52 @@ class searchSector {
     double getAngularSearchVolume(){
         return angularSearchVolume;
     }
+
+    //Sets search form Radar Range Equation constant, every term of received SNR except target RCS and range
+    //Unit: decible
+    void setSearchSNRConstant(double snrConstant){
+        searchSNRConstant = snrConstant;
+    }
+
+    //Gets search form Radar Range Equation constant
+    //Unit: decible
+    double getSearchSNRConstant(){
+        return searchSNRConstant;
+    }
+
+    //Gets maximum range a target can be detected at by sector
+    //Unit: meters
+    double getMaxDetectRange(){
+        return maxDetectRange;
+    }
+
+    //Sets false alarm parameters of sector's search beams. Pfa of 0 turns false alarms off
+    //Inputs: pfa = probability of false alarm per range cell (unitless). cellSize = range resolution cell size
+    void setFalseAlarms(double pfa, lengthValue cellSize){
+        if(pfa < 0 || pfa >= 1 || cellSize <= 0 * units::m){
+            cout << "Error, invalid search sector false alarm parameters" << endl;
+            exit(1);
+        }
+        falseAlarmPfa = pfa;
+        rangeCellSize = cellSize / units::m;
+    }
+
+    //Gets probability of false alarm per range cell
+    //Unit: unitless
+    double getFalseAlarmPfa(){
+        return falseAlarmPfa;
+    }
+
+    //Gets range resolution cell size
+    //Unit: meters
+    double getRangeCellSize(){
+        return rangeCellSize;
+    }
+
+    //Gets amount of range cells of a search beam over sector's range extent
+    long getRangeCellCount(){
+        return (long)ceil((rangeExtent[1] - rangeExtent[0]) / rangeCellSize);
+    }
 ///////////////////////////////////////////////////////////////////////////////
 
     //Initializes/calculates sectors angular search volume.
@@ -139,24 +186,34 @@ class searchSector {
     }
 
 
+    //Initializes/calculates maximum detectable range by solving the search form Radar Range Equation for range, using the
+    //largest RCS present. Range is limited to sector's range extent
+    //Inputs: maxRCS = largest target RCS (dBm^2). snrMin = minimum SNR needed for detection (decible)
+    void initializeMaxDetectRange(double maxRCS, double snrMin){
+        maxDetectRange = pow(10, (searchSNRConstant + maxRCS - snrMin)/40);
+        if(maxDetectRange > rangeExtent[1]){
+            maxDetectRange = rangeExtent[1];
+        }
+    }
+
     //Initializes a random starting scanning position within sectors extents
     void randomizedStarScanPos(){
 
         //If statement is used to determine if azimuth extent rolls over 360, which leads to slight differing arithmetic
         if(fovRollOver ==true){
             int extentLengthAz = (360 + azExtent[1]) - azExtent[0]; //Finds the extent displacement between beginning and end azimuth extent
-            double randomPosAz = rand() % extentLengthAz;           //Generates a random number within that extent displacement
+            double randomPosAz = (extentLengthAz > 0) ? rand() % extentLengthAz : 0; //Generates a random number within that extent displacement (sub-degree sectors start at beginning)
             scanPOS[0] = fmod(azExtent[0] + randomPosAz,360);       //Adds that random number the the beginning azimuth extent value and sets as starting scanning position
         }
         else if(fovRollOver == false){
             int extentLengthAz = (azExtent[1] - azExtent[0]); //Same logic as above but without the need to add 360 degrees
-            double randomPosAz = rand() % extentLengthAz;
+            double randomPosAz = (extentLengthAz > 0) ? rand() % extentLengthAz : 0;
             scanPOS[0] = azExtent[0] + randomPosAz;
         }
 
         //Same logic as above, but now for elevation scanning position instead of elevation
        int extentLengthEl = elExtent[1] - elExtent[0]; 
-       double randomPosEl = rand() % extentLengthEl;
+       double randomPosEl = (extentLengthEl > 0) ? rand() % extentLengthEl : 0;
        scanPOS[1] = elExtent[0] + randomPosEl; 
     }
 
@@ -198,13 +255,17 @@ class searchSector {
     }
 
 private:
-    double azExtent[2];         //Search extent in azimuth frame. 0 = leftmost or furtherest counterclockwise position. 1 = rightmost or furthest clockwise position. (degrees)
-    double elExtent[2];         //Search extent in elevation frame. 0 = lowest elevation position. 1 = highest elevation posistion. (degrees)
-    double rangeExtent[2];      //Searching range extent. 0 = closest position. 1 = furthest position. (meters)
+    stateReal azExtent[2];      //Search extent in azimuth frame. 0 = leftmost or furtherest counterclockwise position. 1 = rightmost or furthest clockwise position. (degrees)
+    stateReal elExtent[2];      //Search extent in elevation frame. 0 = lowest elevation position. 1 = highest elevation posistion. (degrees)
+    stateReal rangeExtent[2];   //Searching range extent. 0 = closest position. 1 = furthest position. (meters)
     double refreshRate;         //Time it takes to search the entire search sector. (seconds)
-    double angularSearchVolume; //The angular search volume of the search sector. (degrees^2)
+    stateReal angularSearchVolume; //The angular search volume of the search sector. (degrees^2)
     double dwellTime;           //Time a search beam spends in one scanning position. (seconds)
-    double scanPOS[2];          //Current scanning position. 0 = azimuth position. 1 = elvation position. (degrees)
+    double searchSNRConstant;   //Search Radar Range Equation terms independent of target (RCS and range excluded). (decible)
+    double maxDetectRange;      //Maximum range a target with largest RCS present can be detected at. (meters)
+    stateReal scanPOS[2];       //Current scanning position. 0 = azimuth position. 1 = elvation position. (degrees)
+    double falseAlarmPfa;       //Probability of false alarm per range cell of a search beam. (unitless)
+    double rangeCellSize;       //Range resolution cell size used for false alarms. (meters)
     bool fovRollOver;           //boolean used if the azimuth search extent rolls over 360 degrees.  Example-> extent from 345degrees to 45degrees.
 
 };
@@ -0,0 +1,395 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: shardedSimulation.h runs one configured radar over several local worker processes, each simulating a
+ *              shard (every Nth target) of the radar's target table. The radar is configured as usual (configManager)
+ *              in the coordinator process, then workers are forked from it, so the scenario (radar, faces, sectors,
+ *              targets, memory-mapped trajectories) is shared with every worker through copy-on-write memory and is
+ *              never copied, since the simulation only reads targets.
+ *              Workers write detections and track events into single producer/single consumer rings inside a shared
+ *              memory segment. The coordinator drains the rings and, once every worker has finished a frame, merges
+ *              the frame's records in time order (frame, track beams before search, face, search beam time, target)
+ *              and replays them through the coordinator radar (searchDataOutput, callbacks, buffers, console output).
+ *              Workers run with a decoupled beam timeline (radar::setDecoupledTimeline()), where a target's detections
+ *              do not depend on other targets. Output is the same as a single process run of the radar with the
+ *              decoupled timeline on, whatever the amount of workers.
+ *              Coverage heatmaps (coverageMap.h) are accumulated by the coordinator from replayed detections, plus the
+ *              search beam counts of the first worker. A telemetry feed (telemetryFeed.h) is published by the coordinator
+ *              and carries the replayed detections and track events, without search beams.
+ *              With plot extraction (plotExtractor.h), plots need the hits of every shard, so workers start tracks from
+ *              individual search detections and the coordinator extracts plots from the replayed detections for output.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef SHARDEDSIMULATION_H
+#define SHARDEDSIMULATION_H
+#include "radar.h"
+#include <atomic>
+#include <algorithm>
+#include <new>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <stdint.h>
+
+using namespace std;
+
+//Search detection or track event written by a worker process into shared memory
+struct shardRecord {
+   uint64_t frameIndex;    //Simulation frame record was made in
+   int kind;               //0 = search detection. 1 = track event
+   int trackType;          //trackEventType of track event
+   int faceIter;           //Radar face of search detection/track start, -1 for track beams at start of frame
+   int sectorIter;         //Search sector of search detection
+   int targetID;           //ID of truth target
+   double time;            //Frame time of detection, or time of track event. (seconds)
+   double dwellTime;       //Time search beam was sent (time of track event for track events). (seconds)
+   double snr;             //Received SNR of search detection. (decible)
+   double azPos;           //Search beam azimuth position, or next track beam azimuth position. (degrees)
+   double elPos;           //Search beam elevation position, or next track beam elevation position. (degrees)
+   double range;           //Range of search detection. (meters)
+};
+
+//Single producer (worker)/single consumer (coordinator) ring of one worker process inside shared memory
+struct shardRing {
+   static const uint64_t CAPACITY = 1 << 16;   //Amount of records ring holds
+
+   alignas(64) atomic<uint64_t> head;          //Amount of records written by worker
+   alignas(64) atomic<uint64_t> tail;          //Amount of records read by coordinator
+   alignas(64) atomic<uint64_t> framesDone;    //Amount of frames worker has written every record of
+   atomic<int> finished;                       //Worker finished simulation
+   double finalTime;                           //Simulation time worker finished at. (seconds)
+   shardRecord records[CAPACITY];
+};
+
+class shardedSimulation {
+   public:
+      //Inputs: coordinatorRadar = radar configured with configManager (owns targets). workers = amount of worker processes
+      shardedSimulation(radar &coordinatorRadar, int workers){
+         simRadar = &coordinatorRadar;
+         workerCount = workers;
+         rings = NULL;
+         workerRing = NULL;
+         workerFrame = 0;
+         sharedVisits = NULL;
+         visitCount = 0;
+      }
+      ~shardedSimulation(){}
+
+      //Gets amount of worker processes
+      int getWorkerCount(){
+         return workerCount;
+      }
+
+/*//////////////////////////////////////////////////////////////////////////////
+ * Description: startSimulation() runs the radar's full simulation (simLength)
+                split across worker processes. Merged records are replayed through
+                the coordinator radar as they would be by radar::startSimulation()
+                with the decoupled timeline on.
+ *//////////////////////////////////////////////////////////////////////////////
+      void startSimulation(){
+         if(workerCount < 1){
+            cout << "Error, sharded simulation needs at least one worker process" << endl;
+            exit(1);
+         }
+         if(simRadar->getRealTimePacer().isEnabled()){
+            cout << "Error, real-time mode is not supported for sharded simulations" << endl;
+            exit(1);
+         }
+         if(simRadar->getMeasurementAssociation()){
+            cout << "Error, measurement association couples targets and is not supported for sharded simulations" << endl;
+            exit(1);
+         }
+         simRadar->setDecoupledTimeline(true);
+         simRadar->beginSimulation();
+
+         //Shared memory segment holding every worker's ring, mapped before forking so every process sees the same pages
+         size_t segmentSize = sizeof(shardRing) * workerCount;
+         void* segment = mmap(NULL, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+         if(segment == MAP_FAILED){
+            cout << "Error, could not create shared memory for sharded simulation" << endl;
+            exit(1);
+         }
+         rings = (shardRing*)segment;
+         for(int shardIter = 0; shardIter < workerCount; shardIter++){
+            new (&rings[shardIter].head) atomic<uint64_t>(0);
+            new (&rings[shardIter].tail) atomic<uint64_t>(0);
+            new (&rings[shardIter].framesDone) atomic<uint64_t>(0);
+            new (&rings[shardIter].finished) atomic<int>(0);
+            rings[shardIter].finalTime = 0;
+         }
+
+         //Coverage heatmaps: detections are replayed through the coordinator, search beams do not depend on targets and are
+         //counted by the first worker, which copies its beam counts into shared memory when it finishes
+         visitCount = 0;
+         sharedVisits = NULL;
+         if(simRadar->getCoverageMap() != NULL){
+            visitCount = simRadar->getCoverageAccumulator().getVisitTable().size();
+            void* visitSegment = mmap(NULL, visitCount*sizeof(uint64_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+            if(visitSegment == MAP_FAILED){
+               cout << "Error, could not create shared memory for sharded simulation" << endl;
+               exit(1);
+            }
+            sharedVisits = (uint64_t*)visitSegment;
+         }
+
+         cout.flush();
+         vector<pid_t> workerIDs;
+         for(int shardIter = 0; shardIter < workerCount; shardIter++){
+            pid_t pid = fork();
+            if(pid < 0){
+               cout << "Error, could not start worker process" << endl;
+               exit(1);
+            }
+            if(pid == 0){
+               runWorker(shardIter);
+               _exit(0);
+            }
+            workerIDs.push_back(pid);
+         }
+
+         mergeRecords(workerIDs);
+         for(int shardIter = 0; shardIter < workerIDs.size(); shardIter++){
+            waitForWorker(workerIDs[shardIter], 0);
+         }
+
+         simRadar->setTime(rings[0].finalTime);
+         munmap(segment, segmentSize);
+         rings = NULL;
+         if(sharedVisits != NULL){
+            simRadar->getCoverageAccumulator().addVisitTable(sharedVisits, visitCount);
+            munmap(sharedVisits, visitCount*sizeof(uint64_t));
+            sharedVisits = NULL;
+         }
+         simRadar->endSimulation();
+      }
+
+   private:
+      //Function run by a worker process: keeps every workerCount'th target of the radar's target table and simulates them,
+      //writing every record into the worker's ring
+      void runWorker(int shardIter){
+         workerRing = &rings[shardIter];
+         workerFrame = 0;
+
+         const vector<target*> &targetVector = simRadar->getTargetVector();
+         for(int targetIter = shardIter; targetIter < targetVector.size(); targetIter = targetIter + workerCount){
+            shardTargets.push_back(targetVector[targetIter]);
+         }
+         simRadar->setTargetTable(&shardTargets);
+         simRadar->setConsoleOutput(false);
+         simRadar->setStoreSearchHistory(false);
+         simRadar->setDetectionBuffer(NULL, 0);
+         simRadar->setTrackEventBuffer(NULL, 0);
+         simRadar->setDetectionCallback(workerDetection, this);
+         simRadar->setTrackEventCallback(workerTrackEvent, this);
+         simRadar->setFalseAlarmGeneration(shardIter == 0); //False alarms do not depend on targets, one worker generates them
+         if(shardIter != 0){
+            simRadar->setCoverageMap(NULL); //Search beams are counted by first worker only
+         }
+         simRadar->setTelemetryFeed(NULL); //Feed has a single producer, the coordinator publishes replayed records
+         simRadar->setPlotExtraction(false); //A worker only sees its shard's hits, plots are extracted by the coordinator from replayed hits
+
+         while(simRadar->getTime() <= simRadar->getSimLength()){ //Same loop condition as radar::startSimulation()
+            simRadar->stepFrame();
+            workerFrame = workerFrame + 1;
+            workerRing->framesDone.store(workerFrame, memory_order_release);
+         }
+         workerRing->finalTime = simRadar->getTime();
+         if(sharedVisits != NULL && shardIter == 0){
+            const vector<uint64_t> &visits = simRadar->getCoverageAccumulator().getVisitTable();
+            memcpy(sharedVisits, visits.data(), min(visits.size(), visitCount)*sizeof(uint64_t));
+         }
+         workerRing->finished.store(1, memory_order_release);
+      }
+
+      //Worker callback writing search detections into worker's ring
+      static void workerDetection(const searchDetectRecord &record, void* userData){
+         shardedSimulation* sim = (shardedSimulation*)userData;
+         shardRecord shard;
+         shard.frameIndex = sim->workerFrame;
+         shard.kind = 0;
+         shard.trackType = 0;
+         shard.faceIter = record.faceIter;
+         shard.sectorIter = record.sectorIter;
+         shard.targetID = (record.detectedTarget != NULL) ? record.detectedTarget->getTargetID() : -1; //-1 = false alarm
+         shard.time = record.time;
+         shard.dwellTime = record.dwellTime;
+         shard.snr = record.snr;
+         shard.azPos = record.azPos;
+         shard.elPos = record.elPos;
+         shard.range = record.range;
+         sim->pushRecord(shard);
+      }
+
+      //Worker callback writing track events into worker's ring
+      static void workerTrackEvent(const trackEventRecord &record, void* userData){
+         shardedSimulation* sim = (shardedSimulation*)userData;
+         shardRecord shard;
+         shard.frameIndex = sim->workerFrame;
+         shard.kind = 1;
+         shard.trackType = record.type;
+         shard.faceIter = record.faceIter;
+         shard.sectorIter = -1;
+         shard.targetID = record.trackedTarget->getTargetID();
+         shard.time = record.time;
+         shard.dwellTime = record.time;
+         shard.snr = 0;
+         shard.azPos = record.nextScanAz;
+         shard.elPos = record.nextScanEl;
+         shard.range = 0;
+         sim->pushRecord(shard);
+      }
+
+      //Function writes a record into worker's ring, waiting for the coordinator while the ring is full
+      void pushRecord(const shardRecord &shard){
+         uint64_t head = workerRing->head.load(memory_order_relaxed);
+         while(head - workerRing->tail.load(memory_order_acquire) >= shardRing::CAPACITY){
+            usleep(50);
+         }
+         workerRing->records[head % shardRing::CAPACITY] = shard;
+         workerRing->head.store(head + 1, memory_order_release);
+      }
+
+      //Function drains every worker's ring and replays each frame's records in time order once every worker has finished the frame
+      void mergeRecords(vector<pid_t> &workerIDs){
+         //Truth targets by ID, records only carry target IDs
+         const vector<target*> &targetVector = simRadar->getTargetVector();
+         vector<target*> targetByID;
+         for(int targetIter = 0; targetIter < targetVector.size(); targetIter++){
+            int ID = targetVector[targetIter]->getTargetID();
+            if(ID >= targetByID.size()){
+               targetByID.resize(ID + 1, NULL);
+            }
+            targetByID[ID] = targetVector[targetIter];
+         }
+
+         vector< vector<shardRecord> > pending(workerCount);  //Records read from each ring but not yet merged
+         vector<shardRecord> frameRecords;                    //Records of frames every worker has finished
+         while(true){
+            bool allFinished = true;
+            bool progress = false;
+            uint64_t readyFrames = UINT64_MAX;
+            for(int shardIter = 0; shardIter < workerCount; shardIter++){
+               shardRing &ring = rings[shardIter];
+               //Frame progress is read before draining, so every record of a finished frame is already in the ring
+               uint64_t framesDone = ring.framesDone.load(memory_order_acquire);
+               bool finished = ring.finished.load(memory_order_acquire) == 1;
+               uint64_t tail = ring.tail.load(memory_order_relaxed);
+               uint64_t head = ring.head.load(memory_order_acquire);
+               for(; tail < head; tail++){
+                  pending[shardIter].push_back(ring.records[tail % shardRing::CAPACITY]);
+                  progress = true;
+               }
+               ring.tail.store(tail, memory_order_release);
+               if(finished == false){
+                  allFinished = false;
+                  readyFrames = min(readyFrames, framesDone);
+               }
+            }
+
+            //Gathering records of finished frames (each worker writes records in frame order)
+            frameRecords.clear();
+            for(int shardIter = 0; shardIter < workerCount; shardIter++){
+               vector<shardRecord> &records = pending[shardIter];
+               int count = 0;
+               while(count < records.size() && records[count].frameIndex < readyFrames){
+                  count = count + 1;
+               }
+               frameRecords.insert(frameRecords.end(), records.begin(), records.begin() + count);
+               records.erase(records.begin(), records.begin() + count);
+            }
+            stable_sort(frameRecords.begin(), frameRecords.end(), compareRecords);
+            for(int recordIter = 0; recordIter < frameRecords.size(); recordIter++){
+               replayRecord(frameRecords[recordIter], targetByID);
+            }
+
+            if(allFinished == true){
+               return;
+            }
+            if(progress == false){
+               for(int shardIter = 0; shardIter < workerIDs.size(); shardIter++){
+                  if(rings[shardIter].finished.load(memory_order_acquire) == 0){
+                     waitForWorker(workerIDs[shardIter], WNOHANG);
+                  }
+               }
+               usleep(100);
+            }
+         }
+      }
+
+      //Function replays a merged record through the coordinator radar, as the radar emits it in a single process run
+      void replayRecord(const shardRecord &shard, vector<target*> &targetByID){
+         target* recordTarget = (shard.targetID >= 0) ? targetByID[shard.targetID] : NULL; //False alarms have no target
+         if(shard.kind == 0){
+            searchDetectRecord record;
+            record.time = shard.time;
+            record.dwellTime = shard.dwellTime;
+            record.snr = shard.snr;
+            record.azPos = shard.azPos;
+            record.elPos = shard.elPos;
+            record.range = shard.range;
+            record.faceIter = shard.faceIter;
+            record.sectorIter = shard.sectorIter;
+            record.detectedTarget = recordTarget;
+            simRadar->emitSearchDetectRecord(record);
+            return;
+         }
+         trackEventRecord record;
+         record.type = (trackEventType)shard.trackType;
+         record.time = shard.time;
+         record.nextScanAz = shard.azPos;
+         record.nextScanEl = shard.elPos;
+         record.faceIter = shard.faceIter;
+         record.track = NULL; //Track profiles live in worker processes
+         record.trackedTarget = recordTarget;
+         if(record.type == TRACK_STARTED){
+            simRadar->emitTrackMessage("Target detected, starting track at: ", recordTarget, record.time);
+         }
+         else if(record.type == TRACK_LOST){
+            simRadar->emitTrackMessage("Lost track of target at: ", recordTarget, record.time);
+         }
+         simRadar->emitTrackEventRecord(record);
+      }
+
+      //Function waits for a worker process. A worker that failed stops the simulation
+      //Inputs: pid = worker process. options = waitpid options (WNOHANG to only check)
+      void waitForWorker(pid_t pid, int options){
+         int status = 0;
+         pid_t result = waitpid(pid, &status, options);
+         if(result == 0 || (result < 0 && errno == ECHILD)){
+            return; //Still running, or already waited for
+         }
+         if(result < 0 || WIFEXITED(status) == false || WEXITSTATUS(status) != 0){
+            cout << "Error, sharded simulation worker process failed" << endl;
+            exit(1);
+         }
+      }
+
+      //Merge order of records: frame, track beams at start of frame before search beams, face, search beam time, target, detection before track start
+      static bool compareRecords(const shardRecord &first, const shardRecord &second){
+         if(first.frameIndex != second.frameIndex){
+            return first.frameIndex < second.frameIndex;
+         }
+         if(first.faceIter != second.faceIter){
+            return first.faceIter < second.faceIter;
+         }
+         if(first.dwellTime != second.dwellTime){
+            return first.dwellTime < second.dwellTime;
+         }
+         if(first.targetID != second.targetID){
+            return (unsigned int)first.targetID < (unsigned int)second.targetID; //False alarms (-1) follow target hits of their search beam
+         }
+         return first.kind < second.kind;
+      }
+
+      radar* simRadar;                 //Coordinator radar, configured scenario and destination of merged records
+      int workerCount;                 //Amount of worker processes
+      shardRing* rings;                //Shared memory rings, one per worker
+      shardRing* workerRing;           //Ring of current worker process (worker only)
+      uint64_t workerFrame;            //Frame current worker process is simulating (worker only)
+      vector<target*> shardTargets;    //Targets simulated by current worker process (worker only)
+      uint64_t* sharedVisits;          //Shared memory search beam counts of coverage heatmaps, NULL without coverage map
+      size_t visitCount;               //Amount of search beam counts in sharedVisits
+};
+
+#endif
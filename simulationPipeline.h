@@ -0,0 +1,246 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: simulationPipeline.h contains the stages of a pipelined simulation (radar::setPipelinedExecution()). A
+ *              radar's startSimulation() then runs three stages, each on its own thread, connected by bounded lock-free
+ *              queues (spscQueue.h):
+ *                 truth stage  = builds the range cull index (rangeCulling.h) and illumination bounds
+ *                                (illuminationSchedule.h) of upcoming frames ahead of time. Without range culling and
+ *                                illumination scheduling it has nothing to build
+ *                 sensing      = the radar's own thread: track servicing and track filter updates, search beams and
+ *                                detection tests, consuming truth frames and handing every record it emits to the output
+ *                                stage
+ *                 output stage = record emission, in the order sensing emitted them: detection history, plots,
+ *                                coverage, telemetry, callbacks, caller-owned buffers, console and real-time pacing
+ *              Truth frames are requested by sensing, in frame order. With a decoupled timeline frame start times are
+ *              known in advance, so the truth stage runs several frames ahead with the exact frame window. Otherwise
+ *              track beams delay each frame's search by an amount only known once they are serviced, so the next frame is
+ *              requested once the current frame's tracks are serviced, with its window widened for the next frame's
+ *              track beams; a frame whose search starts outside its truth frame is propagated by sensing as before.
+ *              Truth frames are conservative (the same bounds sensing would build), and records keep their order, so a
+ *              pipelined simulation makes the same detections, tracks and output as a serial one.
+ *              Limits: each target is still viewed from the site (radarSite::getView()) by sensing at the time of every
+ *              search/track beam that tests it. Beam times depend on the confirmation beams sent earlier in the frame, so
+ *              they are not known to the truth stage, and these per beam views are most of the propagation cost. Only the
+ *              per frame index/bound builds and record output leave the sensing thread, and the stages only pay off with
+ *              a core free for each. On a single core the stage threads compete with sensing and add queue hand-offs, so
+ *              a pipelined run is slower than a serial one.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef SIMULATIONPIPELINE_H
+#define SIMULATIONPIPELINE_H
+#include "target.h"
+#include "radarSite.h"
+#include "rangeCulling.h"
+#include "illuminationSchedule.h"
+#include "simulationRecords.h"
+#include "spscQueue.h"
+#include "perfCounters.h"
+#include <vector>
+#include <deque>
+#include <thread>
+
+using namespace std;
+
+//Kinds of entries handed from sensing to output stage
+enum outputEventKind {
+   OUTPUT_DETECTION = 0,   //Search detection
+   OUTPUT_TRACK = 1,       //Track event
+   OUTPUT_MESSAGE = 2,     //Track message (track started/lost) printed to console or real-time output
+   OUTPUT_BEAM = 3,        //Search beam sent (coverage heatmaps, telemetry)
+   OUTPUT_PLOT = 4,        //Plot extracted from a face's frame
+   OUTPUT_FRAME = 5,       //Frame complete (real-time pacing)
+   OUTPUT_STOP = 6         //Simulation ended, output stage returns
+};
+
+//Single entry handed from sensing to output stage
+struct outputEvent {
+   outputEventKind kind;
+   searchDetectRecord detection;    //Search detection (OUTPUT_DETECTION). Search beam position/time/face/sector (OUTPUT_BEAM)
+   trackEventRecord track;          //Track event (OUTPUT_TRACK)
+   plotRecord plot;                 //Extracted plot (OUTPUT_PLOT)
+   double estimatedXYZ[3];          //Track's estimated position at time of track event. (meters)
+   const char* message;             //Track message (OUTPUT_MESSAGE)
+   target* messageTarget;           //Target of track message
+   double time;                     //Time of track message or completed frame. (seconds)
+};
+
+//Truth frame requested by sensing
+struct truthRequest {
+   double time;      //Start of frame window. (seconds)
+   double window;    //Length of frame window. (seconds)
+   bool stop;        //Truth stage returns
+};
+
+//Targets propagated to the start of a frame window
+struct truthFrame {
+   double time;                           //Start of frame window. (seconds)
+   double window;                         //Length of frame window. (seconds)
+   rangeCullIndex index;                  //Range cull index of window (range culling)
+   vector<illuminationBounds> bounds;     //Illumination bounds of every target in window (illumination scheduling)
+};
+
+class truthStage {
+   public:
+      truthStage(){
+         targets = NULL;
+         site = NULL;
+         buildIndex = false;
+         buildBounds = false;
+         running = false;
+         framesUsed = 0;
+         framesMissed = 0;
+      }
+      ~truthStage(){
+         stop();
+      }
+      truthStage(const truthStage&) = delete;
+      truthStage& operator=(const truthStage&) = delete;
+
+      //Function starts truth stage thread. Targets and site are only read, by both threads, while stage runs
+      //Inputs: indexFrames/boundFrames = truth frames hold a range cull index/illumination bounds. depth = most frames requested at once
+      void start(vector<target*>* targetTable, radarSite* viewSite, bool indexFrames, bool boundFrames, int depth){
+         stop();
+         targets = targetTable;
+         site = viewSite;
+         buildIndex = indexFrames;
+         buildBounds = boundFrames;
+         frames.clear();
+         frames.resize(depth);
+         requests.reset(depth + 1); //Room for stop request
+         produced.reset(depth);
+         freeFrames.reset(depth);
+         for(int frameIter = 0; frameIter < depth; frameIter++){
+            freeFrames.push(&frames[frameIter]);
+         }
+         requestedTimes.clear();
+         maxPending = depth;
+         framesUsed = 0;
+         framesMissed = 0;
+         running = true;
+         worker = thread(run, this);
+      }
+
+      //Function stops truth stage thread, dropping frames not taken
+      void stop(){
+         if(running == false){
+            return;
+         }
+         truthRequest request;
+         request.time = 0;
+         request.window = 0;
+         request.stop = true;
+         requests.push(request);
+         worker.join();
+         running = false;
+      }
+
+      //Gets bool determining if truth stage is running
+      bool isRunning(){
+         return running;
+      }
+
+      //Function determines if another frame can be requested (fewer than depth frames requested and not taken)
+      bool canRequest(){
+         return running == true && requestedTimes.size() < maxPending;
+      }
+
+      //Function requests a truth frame for a window starting at time. Frames are produced in order requested
+      //Units: seconds
+      void request(double time, double windowLength){
+         truthRequest request;
+         request.time = time;
+         request.window = windowLength;
+         request.stop = false;
+         requests.push(request);
+         requestedTimes.push_back(time);
+      }
+
+      //Function takes the truth frame requested for a window starting at or before time, waiting for it if still being produced.
+      //Frames requested for earlier windows are dropped. If the frame contains the window of windowLength starting at time, its
+      //index/bounds are swapped into index/schedule. Frames requested for later windows are left. Returns true if a frame was used
+      //Units: seconds
+      bool take(double time, double windowLength, rangeCullIndex &index, illuminationSchedule &schedule){
+         bool used = false;
+         while(requestedTimes.empty() == false && requestedTimes.front() <= time){
+            truthFrame* frame;
+            produced.pop(frame);
+            requestedTimes.pop_front();
+            if(frame->time <= time && time + windowLength <= frame->time + frame->window){
+               if(buildIndex == true){
+                  index.swap(frame->index);
+               }
+               if(buildBounds == true){
+                  schedule.adoptBounds(frame->bounds, frame->time, frame->window);
+               }
+               used = true;
+               framesUsed = framesUsed + 1;
+            }
+            else{
+               framesMissed = framesMissed + 1;
+            }
+            freeFrames.push(frame); //Frame now holds storage index/schedule used before, reused by a later frame
+         }
+         return used;
+      }
+
+      //Gets amount of truth frames used by sensing
+      long getFramesUsed(){
+         return framesUsed;
+      }
+
+      //Gets amount of truth frames dropped because sensing's window started outside of them
+      long getFramesMissed(){
+         return framesMissed;
+      }
+
+   private:
+      //Truth stage thread, produces requested frames until stopped
+      static void run(truthStage* stage){
+         PERF_PHASE(PHASE_PROPAGATION);
+         truthRequest request;
+         while(true){
+            stage->requests.pop(request);
+            if(request.stop == true){
+               return;
+            }
+            truthFrame* frame;
+            stage->freeFrames.pop(frame);
+            stage->propagate(*frame, request.time, request.window);
+            stage->produced.push(frame);
+         }
+      }
+
+      //Function propagates every target to a frame window
+      void propagate(truthFrame &frame, double time, double windowLength){
+         vector<target*> &targetVector = *targets;
+         frame.time = time;
+         frame.window = windowLength;
+         if(buildIndex == true){
+            frame.index.build(targetVector, *site, time, windowLength);
+         }
+         if(buildBounds == true){
+            frame.bounds.resize(targetVector.size());
+            for(int targetIter = 0; targetIter < targetVector.size(); targetIter++){
+               illuminationSchedule::computeBounds(targetVector[targetIter], *site, time, windowLength, frame.bounds[targetIter]);
+            }
+         }
+      }
+
+      vector<target*>* targets;              //Target table propagated, only read
+      radarSite* site;                       //Site targets are viewed from
+      bool buildIndex;                       //Truth frames hold a range cull index
+      bool buildBounds;                      //Truth frames hold illumination bounds
+      bool running;                          //Truth stage thread is running
+      vector<truthFrame> frames;             //Every truth frame, each owned by the stage holding its pointer
+      spscQueue<truthRequest> requests;      //Frames requested, sensing to truth stage
+      spscQueue<truthFrame*> produced;       //Frames produced, truth stage to sensing
+      spscQueue<truthFrame*> freeFrames;     //Frames taken, sensing to truth stage
+      deque<double> requestedTimes;          //Window start of frames requested and not yet taken, in order (sensing only)
+      size_t maxPending;                     //Most frames requested and not yet taken
+      long framesUsed;                       //Frames used by sensing
+      long framesMissed;                     //Frames dropped by sensing
+      thread worker;                         //Truth stage thread
+};
+
+#endif
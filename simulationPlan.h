@@ -0,0 +1,193 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: simulationPlan.h contains the compiled, read-only form of a radar's configuration. Once the radar faces and
+ *              search sectors are configured (configManager.h), every quantity the engine derives from them is computed
+ *              and validated once: sector dwell times, face FOV and beamwidths, and the target independent terms of the
+ *              search and track Radar Range Equations. Only what the engine reads is kept. Faces and sectors are flattened
+ *              into two contiguous tables, each face pointing to its consecutive run of sectors (the order its search
+ *              beams cycle through them).
+ *              A plan never changes after it is built, so it is handed around as shared_ptr<const simulationPlan> and can
+ *              be shared by threads and by repeated runs of the same configuration. Scanning state (current scan position,
+ *              current sector) and target dependent values (maximum detectable range) stay with the radar objects.
+ *              matches() recompiles every face and sector and compares the result, so a radar can tell a plan gone stale
+ *              because a face or sector was reconfigured after the plan was built.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef SIMULATIONPLAN_H
+#define SIMULATIONPLAN_H
+#include "radarFace.h"
+#include "searchSector.h"
+#include <vector>
+#include <memory>
+#include <math.h>
+#include <iostream>
+
+using namespace std;
+
+//Compiled search sector
+struct sectorPlan {
+   double dwellTime;             //Time of one search beam. (seconds)
+   double searchSNRConstant;     //Search Radar Range Equation terms independent of target (RCS and range excluded). (decible)
+};
+
+//Compiled radar face
+struct facePlan {
+   double boresight[2];          //Boresight. 0 = azimuth. 1 = elevation. (degrees)
+   double azExtent[2];           //Azimuth FOV. 0 = leftmost position. 1 = rightmost position. (degrees)
+   double elExtent[2];           //Elevation FOV. 0 = lowest position. 1 = highest position. (degrees)
+   bool fovRollOver;             //Azimuth FOV rolls over 360 degrees
+   double halfPowerBeamWidth[2]; //Search beam 3dB beamwidth. 0 = azimuth. 1 = elevation. (degrees)
+   double SNRmin;                //Minimum detectable SNR of search beams. (decible)
+   double trackSNRConstant;      //Track Radar Range Equation terms independent of target (RCS and range excluded). (decible)
+   double minDwellTime;          //Shortest dwell time of face's sectors. (seconds)
+   int firstSector;              //First of face's sectors in sector table
+   int sectorCount;              //Amount of face's sectors
+};
+
+class simulationPlan {
+   public:
+      //Function compiles the plan of a radar's configured faces and their search sectors. Exits on invalid configuration
+      simulationPlan(const vector<radarFace*> &faceVector){
+         if(faceVector.empty()){
+            cout << "Error, simulation plan needs at least one radar face" << endl;
+            exit(1);
+         }
+         maxDwellTime = 0;
+         for(int faceIter = 0; faceIter < faceVector.size(); faceIter++){
+            radarFace* face = faceVector[faceIter];
+            const vector<searchSector*> &sectorVector = face->getSearchSectorVector();
+            if(sectorVector.empty() || face->getHalfPowerBeamWidth(0) <= 0 || face->getHalfPowerBeamWidth(1) <= 0 || face->getWaveFreq() <= 0){
+               cout << "Error, invalid configuration of radar face " << faceIter + 1 << endl;
+               exit(1);
+            }
+            facePlan faceEntry = compileFace(face, sectors.size());
+            for(int sectorIter = 0; sectorIter < sectorVector.size(); sectorIter++){
+               searchSector* sector = sectorVector[sectorIter];
+               if(sector->getDwellTime() <= 0 || sector->getAngularSearchVolume() <= 0 || sector->getRangeExtent(1) <= sector->getRangeExtent(0)){
+                  cout << "Error, invalid configuration of search sector " << sectorIter + 1 << " of radar face " << faceIter + 1 << endl;
+                  exit(1);
+               }
+               sectorPlan sectorEntry = compileSector(face, sector);
+               faceEntry.minDwellTime = min(faceEntry.minDwellTime, sectorEntry.dwellTime);
+               maxDwellTime = max(maxDwellTime, sectorEntry.dwellTime);
+               sectors.push_back(sectorEntry);
+            }
+            faces.push_back(faceEntry);
+         }
+      }
+      ~simulationPlan(){}
+
+      //Gets amount of radar faces
+      int getFaceCount() const {
+         return faces.size();
+      }
+
+      //Gets a compiled radar face
+      const facePlan& getFace(int faceIter) const {
+         return faces[faceIter];
+      }
+
+      //Gets longest dwell time of all faces' sectors
+      //Unit: seconds
+      double getMaxDwellTime() const {
+         return maxDwellTime;
+      }
+
+      //Gets amount of search sectors over all faces
+      int getSectorCount() const {
+         return sectors.size();
+      }
+
+      //Gets a compiled search sector by its position within its face
+      const sectorPlan& getSector(int faceIter, int sectorIter) const {
+         return sectors[faces[faceIter].firstSector + sectorIter];
+      }
+
+      //Gets sector table, every face's sectors in face order
+      const vector<sectorPlan>& getSectorTable() const {
+         return sectors;
+      }
+
+      //Function determines if plan is what radar faces and their search sectors currently compile to: same faces and sectors, and
+      //every compiled quantity equal. A face or sector configured differently after the plan was built no longer matches
+      bool matches(const vector<radarFace*> &faceVector) const {
+         if(faceVector.size() != faces.size()){
+            return false;
+         }
+         for(int faceIter = 0; faceIter < faceVector.size(); faceIter++){
+            radarFace* face = faceVector[faceIter];
+            const vector<searchSector*> &sectorVector = face->getSearchSectorVector();
+            const facePlan &faceEntry = faces[faceIter];
+            if(sectorVector.size() != faceEntry.sectorCount){
+               return false;
+            }
+            facePlan current = compileFace(face, faceEntry.firstSector);
+            for(int sectorIter = 0; sectorIter < sectorVector.size(); sectorIter++){
+               sectorPlan currentSector = compileSector(face, sectorVector[sectorIter]);
+               const sectorPlan &sectorEntry = sectors[faceEntry.firstSector + sectorIter];
+               if(currentSector.dwellTime != sectorEntry.dwellTime || currentSector.searchSNRConstant != sectorEntry.searchSNRConstant){
+                  return false;
+               }
+               current.minDwellTime = min(current.minDwellTime, currentSector.dwellTime);
+            }
+            for(int i = 0; i < 2; i++){
+               if(current.boresight[i] != faceEntry.boresight[i] || current.azExtent[i] != faceEntry.azExtent[i] ||
+                  current.elExtent[i] != faceEntry.elExtent[i] || current.halfPowerBeamWidth[i] != faceEntry.halfPowerBeamWidth[i]){
+                  return false;
+               }
+            }
+            if(current.fovRollOver != faceEntry.fovRollOver || current.SNRmin != faceEntry.SNRmin ||
+               current.trackSNRConstant != faceEntry.trackSNRConstant || current.minDwellTime != faceEntry.minDwellTime){
+               return false;
+            }
+         }
+         return true;
+      }
+
+   private:
+      //Function compiles a radar face, its sectors' dwell times not yet included (minDwellTime starts at HUGE_VAL)
+      static facePlan compileFace(radarFace* face, int firstSector){
+         facePlan faceEntry;
+         for(int i = 0; i < 2; i++){
+            faceEntry.boresight[i] = face->getBoresight(i);
+            faceEntry.azExtent[i] = face->getAzExtent(i);
+            faceEntry.elExtent[i] = face->getElExtent(i);
+            faceEntry.halfPowerBeamWidth[i] = face->getHalfPowerBeamWidth(i);
+         }
+         faceEntry.fovRollOver = face->getFovRollOverBool();
+         faceEntry.SNRmin = face->getSNRmin();
+         faceEntry.trackSNRConstant = trackSNRConstant(face);
+         faceEntry.minDwellTime = HUGE_VAL;
+         faceEntry.firstSector = firstSector;
+         faceEntry.sectorCount = face->getSearchSectorVector().size();
+         return faceEntry;
+      }
+
+      //Function compiles a search sector of a radar face
+      static sectorPlan compileSector(radarFace* face, searchSector* sector){
+         sectorPlan sectorEntry;
+         sectorEntry.dwellTime = sector->getDwellTime();
+         sectorEntry.searchSNRConstant = searchSNRConstant(face, sector);
+         return sectorEntry;
+      }
+
+      //Function computes terms of the search form Radar Range Equation independent of target, in decible
+      //10*log10(3283) from degrees^2 to steradian, 10*log10(1.38*pow(10,-23)) is Boltzmann's constant, 10*log10(290) standard temperature
+      static double searchSNRConstant(radarFace* face, searchSector* sector){
+         return 10*log10(face->getPowerAvg()) + 10*log10(face->getEffectiveAttenaArea()) + 10*log10(sector->getRefreshRate())
+          - 10*log10(3.14*4) - 10*log10(sector->getAngularSearchVolume()/3283) - 10*log10(1.38*pow(10,-23)) - 10*log10(290) -  face->getTotalSysLoss() - face->getNoiseFigure();
+      }
+
+      //Function computes terms of the track form Radar Range Equation independent of target, in decible
+      static double trackSNRConstant(radarFace* face){
+         return 10*log10(face->getPeakPower())  + 20*log10(face->getEffectiveAttenaArea())
+          - 30*log10(3.14*4) - 10*log10(1.38*pow(10,-23)) - 10*log10(290) -  face->getTotalSysLoss() - face->getNoiseFigure() - 20*log10(face->getWavelength());
+      }
+
+      vector<facePlan> faces;       //Radar faces in radar's face order
+      vector<sectorPlan> sectors;   //Search sectors, every face's sectors consecutive in face order
+      double maxDwellTime;          //Longest dwell time of all faces' sectors. (seconds)
+};
+
+#endif
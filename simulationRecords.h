@@ -0,0 +1,67 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: simulationRecords.h contains the plain records radar.h emits during a simulation: search detections,
+ *              plots extracted from search detections (plotExtractor.h) and track events (track started, updated, lost).
+ *              Records are handed to user callbacks by reference and/or written directly into caller-owned buffers, so a
+ *              simulation embedding the radar can consume them without copies.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef SIMULATIONRECORDS_H
+#define SIMULATIONRECORDS_H
+
+class target;
+class tracker;
+
+//Single search detection
+struct searchDetectRecord {
+   double time;            //Simulation frame time detection was made. (seconds)
+   double dwellTime;       //Time search beam making the detection was sent. (seconds)
+   double snr;             //Received SNR. (decible)
+   double azPos;           //Azimuth scanning position of search beam, or false alarm's position within beam. (degrees)
+   double elPos;           //Elevation scanning position of search beam, or false alarm's position within beam. (degrees)
+   double range;           //Range of detected target, or of false alarm's range cell. (meters)
+   int faceIter;           //Radar face that made the detection
+   int sectorIter;         //Search sector that made the detection
+   target* detectedTarget; //Truth target detected
+};
+
+//Single plot, search detections of one frame/face clustered by beam position (plotExtractor.h)
+struct plotRecord {
+   double time;            //Simulation frame time plot was extracted. (seconds)
+   double dwellTime;       //Time first search beam contributing to plot was sent. (seconds)
+   double snr;             //Aggregate SNR, summed power of all hits. (decible)
+   double peakSnr;         //Largest SNR of a single hit. (decible)
+   double azPos;           //SNR weighted centroid azimuth of hits' search beams. (degrees)
+   double elPos;           //SNR weighted centroid elevation of hits' search beams. (degrees)
+   int faceIter;           //Radar face that made the hits
+   int sectorIter;         //Search sector that made the hits
+   int hitCount;           //Amount of search detections merged into plot
+   target* detectedTarget; //Truth target of plot's strongest hit (NULL = false alarm), target tracks are started for
+};
+
+//Track event types
+enum trackEventType {
+   TRACK_STARTED = 0,   //Confirmation beam confirmed a search detection
+   TRACK_UPDATED = 1,   //Track beam detected target, filter updated
+   TRACK_LOST = 2       //Track beam missed target, track no longer active
+};
+
+//Single track event
+struct trackEventRecord {
+   trackEventType type;    //Event type
+   double time;            //Time of event. (seconds)
+   double nextScanAz;      //Azimuth position of next track beam. (degrees)
+   double nextScanEl;      //Elevation position of next track beam. (degrees)
+   int faceIter;           //Radar face whose search beam started the track (TRACK_STARTED), -1 for track beams at start of frame
+   tracker* track;         //Track profile event belongs to, recycled for a later track once dropped (valid during callback).
+                           //Pipelined simulations: identifies the track only, profile has moved on by the time of the callback
+   target* trackedTarget;  //Truth target being tracked
+};
+
+//Callback types used to receive records during a simulation. userData is the pointer given when the callback was set.
+typedef void (*searchDetectCallback)(const searchDetectRecord &record, void* userData);
+typedef void (*plotCallback)(const plotRecord &record, void* userData);
+typedef void (*trackEventCallback)(const trackEventRecord &record, void* userData);
+
+#endif
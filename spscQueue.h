@@ -0,0 +1,118 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: spscQueue.h contains a bounded lock-free queue connecting two threads, one producer and one consumer
+ *              (used between the stages of a pipelined simulation, simulationPipeline.h). Entries are stored by value in
+ *              a power of two ring; the producer only writes the tail index and the consumer only writes the head index,
+ *              each published with release/acquire ordering, so an entry is fully written before the consumer can see it.
+ *              Each side also keeps a private copy of the other side's index and only reloads it when the ring looks
+ *              full/empty, so the two threads rarely touch the same cache line.
+ *              push()/pop() wait while the queue is full/empty: they spin briefly, then yield the core, so a producer
+ *              running ahead is throttled by the consumer instead of growing memory without bound.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+#include <atomic>
+#include <vector>
+#include <thread>
+#include <stdint.h>
+
+using namespace std;
+
+static_assert(atomic<uint64_t>::is_always_lock_free, "spscQueue needs lock-free 64 bit atomics");
+
+template <typename T>
+class spscQueue {
+   public:
+      spscQueue(){
+         mask = 0;
+         head.store(0, memory_order_relaxed);
+         tail.store(0, memory_order_relaxed);
+         cachedHead = 0;
+         cachedTail = 0;
+      }
+      ~spscQueue(){}
+      spscQueue(const spscQueue&) = delete;
+      spscQueue& operator=(const spscQueue&) = delete;
+
+      //Function allocates ring, capacity rounded up to a power of two. Queue must be empty and unused by other threads
+      void reset(int capacity){
+         uint64_t size = 1;
+         while(size < (uint64_t)capacity){
+            size = size * 2;
+         }
+         ring.assign(size, T());
+         mask = size - 1;
+         head.store(0, memory_order_relaxed);
+         tail.store(0, memory_order_relaxed);
+         cachedHead = 0;
+         cachedTail = 0;
+      }
+
+      //Function adds an entry unless queue is full. Producer thread only. Returns false if queue is full
+      bool tryPush(const T &entry){
+         uint64_t position = tail.load(memory_order_relaxed);
+         if(position - cachedHead > mask){
+            cachedHead = head.load(memory_order_acquire);
+            if(position - cachedHead > mask){
+               return false;
+            }
+         }
+         ring[position & mask] = entry;
+         tail.store(position + 1, memory_order_release);
+         return true;
+      }
+
+      //Function adds an entry, waiting while queue is full. Producer thread only
+      void push(const T &entry){
+         for(int spin = 0; tryPush(entry) == false; spin++){
+            pause(spin);
+         }
+      }
+
+      //Function removes oldest entry unless queue is empty. Consumer thread only. Returns false if queue is empty
+      bool tryPop(T &entry){
+         uint64_t position = head.load(memory_order_relaxed);
+         if(position == cachedTail){
+            cachedTail = tail.load(memory_order_acquire);
+            if(position == cachedTail){
+               return false;
+            }
+         }
+         entry = ring[position & mask];
+         head.store(position + 1, memory_order_release);
+         return true;
+      }
+
+      //Function removes oldest entry, waiting while queue is empty. Consumer thread only
+      void pop(T &entry){
+         for(int spin = 0; tryPop(entry) == false; spin++){
+            pause(spin);
+         }
+      }
+
+      //Gets amount of entries queue holds
+      int getCapacity(){
+         return ring.size();
+      }
+
+   private:
+      //Function waits between attempts, spinning at first then giving the core to other threads
+      static void pause(int spin){
+         if(spin >= SPIN_LIMIT){
+            this_thread::yield();
+         }
+      }
+
+      static const int SPIN_LIMIT = 64;       //Attempts before a waiting thread yields
+
+      vector<T> ring;                         //Entries, indexed by position & mask
+      uint64_t mask;                          //Ring size - 1
+      alignas(64) atomic<uint64_t> head;      //Position of next entry to pop, written by consumer
+      uint64_t cachedTail;                    //Consumer's copy of tail
+      alignas(64) atomic<uint64_t> tail;      //Position of next entry to push, written by producer
+      uint64_t cachedHead;                    //Producer's copy of head
+};
+
+#endif
@@ -1,22 +1,29 @@
 /*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
  * Unclassified
  * Coder: Weston Yohe
- * Last Modified: 8/11/2022
+ * Last Modified: 10/19/2026
  * Description: target.h contains the properties/characteristics of the targets used in the radar simulation. Such as
  *              target's RCS (Radar-Cross-Section), position, velocity, and acceleration. Additionally, there is logic
  *              to update/change the targets location using basic laws of motion equaitons. Currently target's
- *              characteristics are all static throughout entire simulation, except for target's position.            
+ *              characteristics are all static throughout entire simulation, except for target's position.
+ *              A target's state is evaluated at an absolute simulation time (getStateAt), which derived target types
+ *              override, e.g. recorded trajectory playback in trajectoryTarget.h.
  *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifndef TARGET_H
 #define TARGET_H
 #include "utility.h"
+#include "precision.h"
 #include <iostream>
 using namespace std;
 
 class target {
     public:
-        target(){} 
-        ~target(){}
+        target(){
+            startTime = 0;  //Targets start at beginning of simulation unless injected later
+            targetID = 0;
+            stateTime = 0;
+        } 
+        virtual ~target(){}
 
 ///////////////////////////////////////////////////////////////
 //Setter and getter related functions
@@ -27,7 +34,8 @@ class target {
             coordXYZ[0] = x;
             coordXYZ[1] = y;
             coordXYZ[2] = z;
-            convertCoordXYZtoPolar(coordXYZ); //Additionally converts the coordinates to sphereical form
+            double xyz[3] = {x, y, z};
+            convertCoordXYZtoPolar(xyz); //Additionally converts the coordinates to sphereical form
         }
 
         //Gets initial starting position values in cartesian form.
@@ -81,9 +89,8 @@ class target {
         }
 
         //Sets RCS value
-        //Unit: dBm^2
-        void setRCS(double targetRCS){
-            rcs = targetRCS;
+        void setRCS(decibelValue targetRCS){
+            rcs = targetRCS / units::dB;
         }
 
         //Gets RCS value
@@ -91,32 +98,101 @@ class target {
         double getRCS(){
             return rcs;
         }
+
+        //Sets unique target ID (assigned by radar when target is added)
+        void setTargetID(int ID){
+            targetID = ID;
+        }
+
+        //Gets unique target ID
+        int getTargetID(){
+            return targetID;
+        }
+
+        //Sets simulation time the starting position/velocity refers to (e.g. time a target is injected into a running simulation)
+        //Unit: seconds
+        void setStartTime(double time){
+            startTime = time;
+            stateTime = time;
+        }
+
+        //Gets simulation time of current position
+        //Unit: seconds
+        double getStateTime(){
+            return stateTime;
+        }
 ///////////////////////////////////////////////////////////////////////
 
 
+        //Function evaluates targets cartesian position and velocity at an absolute simulation time using basic laws of motion
+        //Inputs: time = simulation time (seconds). xyz = output position (meters). vel = output velocity (m/s)
+        virtual void getStateAt(double time, double xyz[3], double vel[3]){
+            double deltaTime = time - startTime;    //Time since starting position
+            for(int i = 0; i < 3; i++){             //Loop iterates over each cartesian component
+                xyz[i] = startPos[i] + (velocityVector[i]*deltaTime) + (0.5*accelerationVector[i]*pow(deltaTime,2));
+                vel[i] = velocityVector[i] + (accelerationVector[i]*deltaTime);
+            }
+        }
+
+        //Function determines if target exists at an absolute simulation time. Targets without a recorded time span always exist
+        //Unit: seconds
+        virtual bool isActiveAt(double){
+            return true;
+        }
+
+        //Function determines if target exists at any time within [time, time+window]
+        //Units: seconds
+        virtual bool isActiveDuring(double, double){
+            return true;
+        }
+
+        //Function gives an upper bound on the distance target can travel within [time, time+window], used for range culling
+        //Units: seconds, output in meters
+        virtual double getMaxDisplacement(double time, double window){
+            double xyz[3];
+            double vel[3];
+            getStateAt(time, xyz, vel);
+            double speed = sqrt(pow(vel[0],2) + pow(vel[1],2) + pow(vel[2],2));
+            double acceleration = sqrt(pow(accelerationVector[0],2) + pow(accelerationVector[1],2) + pow(accelerationVector[2],2));
+            return speed*window + 0.5*acceleration*pow(window,2);
+        }
+
+        //Function updates targets current cartesian and spherical position to position at an absolute simulation time
+        //Unit: seconds
+        void updateToTime(double time){
+            double xyz[3];
+            double vel[3];
+            getStateAt(time, xyz, vel);
+            for(int i = 0; i < 3; i++){
+                coordXYZ[i] = xyz[i];
+            }
+            stateTime = time;
+            convertCoordXYZtoPolar(xyz);            //Updates new coordinates to spherical form as well
+        }
+
         //Function updates targets cartesian position to a new position based on the inputted amount of time change
         //Inputs: time 
         //Units: seconds
         void updateCoordinatesXYZ(double time){
-            for(int i = 0; i < 3; i++){             //Loop iterates over each cartesian component
-            double distance = ((velocityVector[i]*time) + (0.5*accelerationVector[i]*pow(time,2))); //Distance traveled based on targets current speed and change in time
-            coordXYZ[i] = coordXYZ[i] + distance;   //Updates current coordinates
-            } 
-            convertCoordXYZtoPolar(coordXYZ);       //Updates new coordinates to spherical form as well
+            updateToTime(stateTime + time);
         }
 
 
         //Function converts current cartesian coordinates to spherical coordinates
         //Inputs: double array[3].  0 = x-position, 1 = y-position, 2 = z-position.
         //Units: meters
-        void convertCoordXYZtoPolar(double xyzCoord[3]){
+        void convertCoordXYZtoPolar(const double xyzCoord[3]){
+            double polar[3];                //Converted in double, then stored
             for(int i = 0; i < 3; i++){     //Loop iterates over each cartesian component
-            coordPolar[i] = xyzCoord[i];    //Copies current cartesian coordinates
+            polar[i] = xyzCoord[i];         //Copies current cartesian coordinates
             }
             
-            utility::rectToPolarRads(coordPolar);   //Converts cartesian coordinates to spherical radians
-            utility::radsToDeg(coordPolar);         //Converts radians to degrees
-            coordPolar[0] = fmod(coordPolar[0]+360,360); //Converts negative values to positive and rids of possible 360degree overflow
+            utility::rectToPolarRads(polar);        //Converts cartesian coordinates to spherical radians
+            utility::radsToDeg(polar);              //Converts radians to degrees
+            polar[0] = fmod(polar[0]+360,360);      //Converts negative values to positive and rids of possible 360degree overflow
+            for(int i = 0; i < 3; i++){
+                coordPolar[i] = polar[i];
+            }
         }
 
         //Function temporarily saves current cartesian coordinates retreived by resetToSavedPos() function.
@@ -124,11 +200,13 @@ class target {
             for(int i = 0; i < 3;i++){
                 tempCoordXYZ[i] = coordXYZ[i]; //Copies current cartesian coordiantes to temp variable 
             }
+            tempStateTime = stateTime;
         }
 
         //Function retrieves saved cartesian coordinate position (from function saveCurrentPoS()) and sets current cartesian position to saved coordinates
         void resetToSavedPOS(){
             setCoordXYZ(tempCoordXYZ[0],tempCoordXYZ[1],tempCoordXYZ[2]); //Setting current cartesian position as saved position
+            stateTime = tempStateTime;
         }
 
         //Function initializes starting cartesian position and initializes current cartesian and spherical position as starting position. Used before starting simulation 
@@ -147,13 +225,17 @@ class target {
         }
 
     private:
-        double startPos[3];             //Target initial starting coordinates in cartesian form. 0 = x-position, 1 = y-position, 2 = z-position. (meters)
-        double coordXYZ[3];             //Target coordinates in cartesian coordinates. 0 = x-position, 1 = y-position, 2 = z-position. (meters)
-        double coordPolar[3];           //Target coordinates in spherical coordinates. 0 = azimuth position(deg), 1 = polar position(deg), 2 = range position(meter)
-        double velocityVector[3];       //Target velocity components in cartesian form. 0 = x-velocity, 1 = y-velocity, 2 = z-velocity. (m/s)
-        double accelerationVector[3];   //Target acceleration components in cartesian form. 0 = x-acceleration, 1 = y-acceleration, 2 = z-acceleration. (m/s^2)
-        double rcs;                     //Target RCS value (Radar-Cross-Section) (dBm^2)
-        double tempCoordXYZ[3];         //Used as a refrence/temporary coordinates. (meters)
+        stateReal startPos[3];          //Target initial starting coordinates in cartesian form. 0 = x-position, 1 = y-position, 2 = z-position. (meters)
+        stateReal coordXYZ[3];          //Target coordinates in cartesian coordinates. 0 = x-position, 1 = y-position, 2 = z-position. (meters)
+        stateReal coordPolar[3];        //Target coordinates in spherical coordinates. 0 = azimuth position(deg), 1 = polar position(deg), 2 = range position(meter)
+        stateReal velocityVector[3];    //Target velocity components in cartesian form. 0 = x-velocity, 1 = y-velocity, 2 = z-velocity. (m/s)
+        stateReal accelerationVector[3]; //Target acceleration components in cartesian form. 0 = x-acceleration, 1 = y-acceleration, 2 = z-acceleration. (m/s^2)
+        stateReal rcs;                  //Target RCS value (Radar-Cross-Section) (dBm^2)
+        stateReal tempCoordXYZ[3];      //Used as a refrence/temporary coordinates. (meters)
+        double tempStateTime;           //Simulation time of temporary coordinates. (seconds)
+        double startTime;               //Simulation time of starting position. (seconds)
+        double stateTime;               //Simulation time of current position. (seconds)
+        int targetID;                   //Unique target ID, used to key random draws
         
 };
 
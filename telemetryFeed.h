@@ -0,0 +1,280 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: telemetryFeed.h contains a live telemetry feed of a running simulation for local viewer/recorder processes.
+ *              The radar publishes every search beam position, search detection and track event into a single
+ *              producer/multiple consumer ring inside a named POSIX shared memory segment (/dev/shm). Every record has a
+ *              sequence number; consumers (telemetryConsumer below, telemetryViewer.cpp) attach and detach at any time,
+ *              each keeping its own read position, and the producer never waits for them: once the ring wraps, the oldest
+ *              records are overwritten and a consumer that fell behind is told how many records it missed.
+ *              Each slot carries a sequence stamp written as a seqlock: odd while the producer writes the slot, then the
+ *              record's sequence number + 1. A consumer copies a slot and keeps the copy only if the stamp was the
+ *              expected one both before and after the copy.
+ *              Segment layout: telemetryHeader, then capacity telemetrySlots. Producer and consumers must be built from the
+ *              same telemetryFeed.h (checked by magic/version/slot size).
+ *              Publishing costs one slot copy per record; a radar without a feed (default) publishes nothing.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TELEMETRYFEED_H
+#define TELEMETRYFEED_H
+#include <atomic>
+#include <string>
+#include <new>
+#include <iostream>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+static_assert(atomic<uint64_t>::is_always_lock_free, "telemetry feed needs lock-free 64 bit atomics in shared memory");
+
+//Kinds of telemetry records
+enum telemetryKind {
+   TELEMETRY_BEAM = 0,        //Search beam sent
+   TELEMETRY_DETECTION = 1,   //Search detection
+   TELEMETRY_TRACK = 2        //Track event (started, updated, lost)
+};
+
+//Single telemetry record
+struct telemetryRecord {
+   uint32_t kind;          //telemetryKind
+   int32_t faceIter;       //Radar face of search beam/detection/track start, -1 for track beams at start of frame
+   int32_t sectorIter;     //Search sector of search beam/detection, trackEventType of track events
+   int32_t targetID;       //Truth target of detection/track, -1 for false alarms and search beams
+   double time;            //Time of search beam, detection's search beam or track event. (seconds)
+   double azPos;           //Search beam azimuth position, or next track beam azimuth position. (degrees)
+   double elPos;           //Search beam elevation position, or next track beam elevation position. (degrees)
+   double range;           //Range of detection. (meters)
+   double snr;             //SNR of detection. (decible)
+   double xyz[3];          //Estimated position of track, site relative. (meters)
+};
+
+//Ring slot, stamp = 2*sequence + 1 while being written, 2*sequence + 2 once record is complete
+struct telemetrySlot {
+   atomic<uint64_t> stamp;
+   telemetryRecord record;
+};
+
+//Segment header
+struct telemetryHeader {
+   static const uint64_t MAGIC = 0x5244524D53494D54ULL;   //"RDRMSIMT"
+   static const uint32_t VERSION = 1;
+
+   uint64_t magic;
+   uint32_t version;
+   uint32_t slotSize;                      //sizeof(telemetrySlot)
+   uint64_t capacity;                      //Amount of slots
+   alignas(64) atomic<uint64_t> published; //Amount of records published, next sequence number
+   atomic<uint32_t> closed;                //Producer closed feed, no more records will be published
+};
+
+class telemetryFeed {
+   public:
+      telemetryFeed(){
+         header = NULL;
+         slots = NULL;
+         capacity = 0;
+         mapSize = 0;
+      }
+      ~telemetryFeed(){
+         close();
+      }
+
+      //Function creates shared memory segment of feed, replacing one left by an earlier run. Exits if segment cannot be created
+      //Inputs: name = segment name (e.g. "/radarsim"). slotCount = records ring holds, rounded up to a power of two
+      void open(string name, uint64_t slotCount = 1 << 16){
+         close();
+         capacity = 1;
+         while(capacity < slotCount){
+            capacity = capacity * 2;
+         }
+         segmentName = name;
+         mapSize = sizeof(telemetryHeader) + capacity*sizeof(telemetrySlot);
+         shm_unlink(name.c_str());
+         int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0644);
+         if(fd < 0 || ftruncate(fd, mapSize) != 0){
+            cout << "Error, could not create telemetry feed " << name << endl;
+            exit(1);
+         }
+         void* segment = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+         ::close(fd);
+         if(segment == MAP_FAILED){
+            cout << "Error, could not map telemetry feed " << name << endl;
+            exit(1);
+         }
+         header = new (segment) telemetryHeader;
+         slots = (telemetrySlot*)((char*)segment + sizeof(telemetryHeader));
+         for(uint64_t slotIter = 0; slotIter < capacity; slotIter++){
+            new (&slots[slotIter].stamp) atomic<uint64_t>(0);
+         }
+         header->capacity = capacity;
+         header->slotSize = sizeof(telemetrySlot);
+         header->version = telemetryHeader::VERSION;
+         new (&header->published) atomic<uint64_t>(0);
+         new (&header->closed) atomic<uint32_t>(0);
+         atomic_thread_fence(memory_order_release);
+         header->magic = telemetryHeader::MAGIC; //Written last, consumers attaching earlier see no feed yet
+      }
+
+      //Function marks feed closed and removes its segment name. Attached consumers still drain remaining records
+      void close(){
+         if(header == NULL){
+            return;
+         }
+         header->closed.store(1, memory_order_release);
+         munmap(header, mapSize);
+         shm_unlink(segmentName.c_str());
+         header = NULL;
+         slots = NULL;
+      }
+
+      //Function determines if feed is open
+      bool isOpen(){
+         return header != NULL;
+      }
+
+      //Function publishes a record, overwriting the oldest record once the ring is full. Never waits for consumers
+      void publish(const telemetryRecord &record){
+         uint64_t sequence = header->published.load(memory_order_relaxed);
+         telemetrySlot &slot = slots[sequence & (capacity - 1)];
+         slot.stamp.store(2*sequence + 1, memory_order_relaxed);
+         atomic_thread_fence(memory_order_release);
+         slot.record = record;
+         slot.stamp.store(2*sequence + 2, memory_order_release);
+         header->published.store(sequence + 1, memory_order_release);
+      }
+
+      //Gets amount of records published
+      uint64_t getPublished(){
+         return (header != NULL) ? header->published.load(memory_order_relaxed) : 0;
+      }
+
+   private:
+      telemetryHeader* header;   //Mapped segment header, NULL when closed
+      telemetrySlot* slots;      //Ring slots following header
+      uint64_t capacity;         //Amount of slots, power of two
+      size_t mapSize;            //Size of mapped segment. (bytes)
+      string segmentName;        //Shared memory segment name
+};
+
+//Result of reading a telemetry feed
+enum telemetryRead {
+   TELEMETRY_RECORD = 0,      //Record read
+   TELEMETRY_EMPTY = 1,       //No new record yet
+   TELEMETRY_ENDED = 2        //Producer closed feed and every record was read
+};
+
+//Reads a telemetry feed from another process. Read-only: consumers never write to the segment, so any amount can attach
+class telemetryConsumer {
+   public:
+      telemetryConsumer(){
+         header = NULL;
+         slots = NULL;
+         mapSize = 0;
+         nextSequence = 0;
+         missed = 0;
+      }
+      ~telemetryConsumer(){
+         detach();
+      }
+
+      //Function attaches to a feed. Returns false if feed does not exist (yet) or was built differently
+      //Inputs: fromOldest = start at oldest record still in ring, otherwise at next published record
+      bool attach(string name, bool fromOldest = false){
+         detach();
+         int fd = shm_open(name.c_str(), O_RDONLY, 0);
+         if(fd < 0){
+            return false;
+         }
+         struct stat info;
+         if(fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(telemetryHeader)){
+            ::close(fd);
+            return false;
+         }
+         mapSize = info.st_size;
+         void* segment = mmap(NULL, mapSize, PROT_READ, MAP_SHARED, fd, 0);
+         ::close(fd);
+         if(segment == MAP_FAILED){
+            return false;
+         }
+         header = (const telemetryHeader*)segment;
+         if(header->magic != telemetryHeader::MAGIC || header->version != telemetryHeader::VERSION || header->slotSize != sizeof(telemetrySlot)
+            || sizeof(telemetryHeader) + header->capacity*sizeof(telemetrySlot) > mapSize){
+            detach();
+            return false;
+         }
+         atomic_thread_fence(memory_order_acquire);
+         slots = (const telemetrySlot*)((const char*)segment + sizeof(telemetryHeader));
+         uint64_t published = header->published.load(memory_order_acquire);
+         nextSequence = published;
+         if(fromOldest == true){
+            nextSequence = (published > header->capacity) ? published - header->capacity : 0;
+         }
+         missed = 0;
+         return true;
+      }
+
+      //Function detaches from feed
+      void detach(){
+         if(header != NULL){
+            munmap((void*)header, mapSize);
+         }
+         header = NULL;
+         slots = NULL;
+      }
+
+      //Function reads next record. Never blocks; records overwritten before they were read are skipped and counted as missed
+      telemetryRead read(telemetryRecord &record){
+         while(true){
+            uint64_t published = header->published.load(memory_order_acquire);
+            if(nextSequence >= published){
+               return (header->closed.load(memory_order_acquire) == 1) ? TELEMETRY_ENDED : TELEMETRY_EMPTY;
+            }
+            //Consumer fell a whole ring behind, jumping to oldest record still in ring
+            if(published - nextSequence > header->capacity){
+               uint64_t oldest = published - header->capacity;
+               missed = missed + (oldest - nextSequence);
+               nextSequence = oldest;
+            }
+            const telemetrySlot &slot = slots[nextSequence & (header->capacity - 1)];
+            uint64_t expected = 2*nextSequence + 2;
+            uint64_t before = slot.stamp.load(memory_order_acquire);
+            if(before == expected){
+               record = slot.record;
+               atomic_thread_fence(memory_order_acquire);
+               if(slot.stamp.load(memory_order_relaxed) == expected){
+                  nextSequence = nextSequence + 1;
+                  return TELEMETRY_RECORD;
+               }
+            }
+            //Slot overwritten by a newer record while reading, record is lost
+            if(before > expected || slot.stamp.load(memory_order_relaxed) > expected){
+               missed = missed + 1;
+               nextSequence = nextSequence + 1;
+            }
+         }
+      }
+
+      //Gets sequence number of next record to be read
+      uint64_t getNextSequence(){
+         return nextSequence;
+      }
+
+      //Gets amount of records skipped because they were overwritten before being read
+      uint64_t getMissed(){
+         return missed;
+      }
+
+   private:
+      const telemetryHeader* header;   //Mapped segment header, NULL when detached
+      const telemetrySlot* slots;      //Ring slots following header
+      size_t mapSize;                  //Size of mapped segment. (bytes)
+      uint64_t nextSequence;           //Sequence number of next record to read
+      uint64_t missed;                 //Records overwritten before being read
+};
+
+#endif
@@ -0,0 +1,117 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: telemetryViewer.cpp is the reference consumer of a simulation's live telemetry feed (telemetryFeed.h). It
+ *              attaches to the feed of a running simulation (radar::setTelemetryFeed()), prints every record and/or
+ *              records them to a binary file (raw telemetryRecords), and reports records it missed by falling more than a
+ *              ring behind. The simulation never waits for the viewer; several viewers can attach at once.
+ *                 g++ -O2 -std=c++17 telemetryViewer.cpp -o telemetryViewer
+ *                 ./telemetryViewer /radarsim                          (print records as they are published)
+ *                 ./telemetryViewer /radarsim --record run.tlm --quiet (record without printing)
+ *              Options: --oldest starts at the oldest record still in the ring instead of the next one published,
+ *              --no-beams skips search beam records, --wait waits for the feed to be created. The viewer ends when the
+ *              simulation closes the feed, or on Ctrl-C.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "telemetryFeed.h"
+#include <stdio.h>
+#include <signal.h>
+
+using namespace std;
+
+volatile sig_atomic_t stopRequested = 0;   //Set by Ctrl-C
+
+void requestStop(int){
+   stopRequested = 1;
+}
+
+//Function prints a record on one line
+void printRecord(uint64_t sequence, const telemetryRecord &record){
+   if(record.kind == TELEMETRY_BEAM){
+      printf("%10llu  %12.4f  beam       face %d sector %d  az %8.3f el %7.3f\n", (unsigned long long)sequence, record.time,
+             record.faceIter + 1, record.sectorIter + 1, record.azPos, record.elPos);
+   }
+   else if(record.kind == TELEMETRY_DETECTION){
+      printf("%10llu  %12.4f  detection  face %d sector %d  az %8.3f el %7.3f  range %10.1f m  snr %6.2f dB  target %d\n",
+             (unsigned long long)sequence, record.time, record.faceIter + 1, record.sectorIter + 1, record.azPos, record.elPos,
+             record.range, record.snr, record.targetID);
+   }
+   else{
+      const char* types[3] = {"started", "updated", "lost"};
+      const char* type = (record.sectorIter >= 0 && record.sectorIter < 3) ? types[record.sectorIter] : "?";
+      printf("%10llu  %12.4f  track %-7s target %d  estimate (%.1f, %.1f, %.1f) m  next beam az %8.3f el %7.3f\n",
+             (unsigned long long)sequence, record.time, type, record.targetID, record.xyz[0], record.xyz[1], record.xyz[2],
+             record.azPos, record.elPos);
+   }
+}
+
+int main(int argc, char** argv){
+   string feedName = "/radarsim";
+   string recordName;
+   bool fromOldest = false;
+   bool quiet = false;
+   bool beams = true;
+   bool wait = false;
+   for(int argIter = 1; argIter < argc; argIter++){
+      string option = argv[argIter];
+      if(option == "--oldest") fromOldest = true;
+      else if(option == "--quiet") quiet = true;
+      else if(option == "--no-beams") beams = false;
+      else if(option == "--wait") wait = true;
+      else if(option == "--record" && argIter + 1 < argc) recordName = argv[++argIter];
+      else if(option[0] == '/') feedName = option;
+      else{
+         cout << "Usage: " << argv[0] << " [/feedName] [--oldest] [--no-beams] [--wait] [--record file.tlm] [--quiet]" << endl;
+         return 1;
+      }
+   }
+   signal(SIGINT, requestStop);
+
+   telemetryConsumer consumer;
+   while(consumer.attach(feedName, fromOldest) == false){
+      if(wait == false || stopRequested == 1){
+         cout << "Error, no telemetry feed " << feedName << endl;
+         return 1;
+      }
+      usleep(100000);
+   }
+   FILE* recordFile = NULL;
+   if(recordName != ""){
+      recordFile = fopen(recordName.c_str(), "wb");
+      if(recordFile == NULL){
+         cout << "Error, could not open " << recordName << endl;
+         return 1;
+      }
+   }
+
+   uint64_t received = 0;
+   telemetryRecord record;
+   while(stopRequested == 0){
+      telemetryRead result = consumer.read(record);
+      if(result == TELEMETRY_ENDED){
+         break;
+      }
+      if(result == TELEMETRY_EMPTY){
+         usleep(1000);
+         continue;
+      }
+      uint64_t sequence = consumer.getNextSequence() - 1;
+      received = received + 1;
+      if(beams == false && record.kind == TELEMETRY_BEAM){
+         continue;
+      }
+      if(recordFile != NULL){
+         fwrite(&record, sizeof(record), 1, recordFile);
+      }
+      if(quiet == false){
+         printRecord(sequence, record);
+      }
+   }
+
+   if(recordFile != NULL){
+      fclose(recordFile);
+   }
+   fprintf(stderr, "%llu record(s) received, %llu missed\n", (unsigned long long)received, (unsigned long long)consumer.getMissed());
+   return 0;
+}
@@ -0,0 +1,319 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: trackAssociation.h contains measurement-to-track association used by radar.h when measurement
+ *              association is enabled. Tracks no longer know which target they follow: every track beam returns
+ *              noisy measurements of all targets inside it, and each track must find its own measurement among them.
+ *              A measurement is a candidate for a track only inside the track's validation gate (distance from the
+ *              track's predicted position). Candidate pairs come from a spatial hash grid rebuilt every scan (cell
+ *              size = gate), so each track only looks at measurements in its 27 neighbouring cells instead of all of
+ *              them. Tracks and measurements are then assigned global-nearest-neighbor (GNN): gated pairs are taken
+ *              in order of increasing distance, each track and each measurement used at most once. This is the usual
+ *              greedy GNN approximation, exact whenever gates do not conflict.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TRACKASSOCIATION_H
+#define TRACKASSOCIATION_H
+#include <vector>
+#include <algorithm>
+#include <stdint.h>
+#include <math.h>
+
+using namespace std;
+
+//Uniform spatial hash grid of integer IDs, rebuilt every scan. Open addressing table of cells, each cell a linked list of IDs
+//in insertion order. Storage is kept between scans, so a rebuilt grid does not allocate once it has grown to its working size.
+//The x axis can wrap (azimuth of angular grids), its cells then go around the wrap period and neighbour across it
+class spatialGrid {
+   public:
+      spatialGrid(){
+         cellSize = 1;
+         cellCount = 0;
+         xCellSize = 1;
+         xCellsAround = 0;
+      }
+      ~spatialGrid(){}
+
+      //Function empties grid and sets cell size (same units as positions inserted). With a wrap period, x positions wrap around
+      //[0, xWrap) (e.g. 360 degrees of azimuth); x cells are widened so a whole number of them go around the period
+      void reset(double size, double xWrap = 0){
+         cellSize = size;
+         xCellSize = size;
+         xCellsAround = 0;
+         if(xWrap > 0){
+            xCellsAround = max((int64_t)1, (int64_t)floor(xWrap/size));
+            xCellSize = xWrap/xCellsAround;
+         }
+         cellCount = 0;
+         entryIDs.clear();
+         entryNext.clear();
+         for(int slotIter = 0; slotIter < slots.size(); slotIter++){
+            slots[slotIter].head = -1;
+         }
+      }
+
+      //Function sizes storage for idCount IDs in as many cells, so rebuilding a grid of up to idCount IDs does not allocate
+      void reserve(int idCount){
+         entryIDs.reserve(idCount);
+         entryNext.reserve(idCount);
+         while(2*idCount > slots.size()){
+            grow();
+         }
+      }
+
+      //Function adds an ID at a position
+      void insert(int id, double x, double y, double z){
+         if(2*(cellCount + 1) > slots.size()){
+            grow(); //Table kept at most half full
+         }
+         int entry = entryIDs.size();
+         entryIDs.push_back(id);
+         entryNext.push_back(-1);
+         uint64_t key = cellKey(xCellOf(x), cellOf(y), cellOf(z));
+         gridSlot &slot = slots[findSlot(key)];
+         if(slot.head == -1){
+            slot.key = key;
+            slot.head = entry;
+            cellCount = cellCount + 1;
+         }
+         else{
+            entryNext[slot.tail] = entry;
+         }
+         slot.tail = entry;
+      }
+
+      //Function gets IDs in the cell of a position and its 26 neighbouring cells, i.e. every ID within one cell size of the position
+      //(and some further). IDs are given in a fixed order for a given grid
+      void query(double x, double y, double z, vector<int> &ids){
+         ids.clear();
+         if(cellCount == 0){
+            return;
+         }
+         int64_t cx = xCellOf(x);
+         int64_t cy = cellOf(y);
+         int64_t cz = cellOf(z);
+         //Wrapped x axis with fewer than 3 cells around, each cell is visited once
+         int64_t xFirst = (xCellsAround > 0 && xCellsAround < 3) ? 0 : cx-1;
+         int64_t xLast = (xCellsAround > 0 && xCellsAround < 3) ? xCellsAround-1 : cx+1;
+         for(int64_t ix = xFirst; ix <= xLast; ix++){
+            int64_t wrappedX = (xCellsAround > 0) ? ((ix % xCellsAround) + xCellsAround) % xCellsAround : ix;
+            for(int64_t iy = cy-1; iy <= cy+1; iy++){
+               for(int64_t iz = cz-1; iz <= cz+1; iz++){
+                  const gridSlot &slot = slots[findSlot(cellKey(wrappedX, iy, iz))];
+                  if(slot.head == -1){
+                     continue;
+                  }
+                  for(int entry = slot.head; entry != -1; entry = entryNext[entry]){
+                     ids.push_back(entryIDs[entry]);
+                  }
+               }
+            }
+         }
+      }
+
+   private:
+      //Table slot, an occupied slot is a cell holding IDs
+      struct gridSlot {
+         uint64_t key;     //Cell key
+         int head;         //First entry of cell, -1 if slot is empty
+         int tail;         //Last entry of cell
+      };
+
+      //Function gets cell index of a coordinate
+      int64_t cellOf(double value){
+         return (int64_t)floor(value/cellSize);
+      }
+
+      //Function gets cell index of an x coordinate, wrapped into [0, xCellsAround) if x axis wraps
+      int64_t xCellOf(double value){
+         int64_t cell = (int64_t)floor(value/xCellSize);
+         if(xCellsAround > 0){
+            cell = ((cell % xCellsAround) + xCellsAround) % xCellsAround;
+         }
+         return cell;
+      }
+
+      //Function packs cell indices into a hash key (21 bits per axis)
+      static uint64_t cellKey(int64_t x, int64_t y, int64_t z){
+         return (((uint64_t)x & 0x1FFFFF) << 42) | (((uint64_t)y & 0x1FFFFF) << 21) | ((uint64_t)z & 0x1FFFFF);
+      }
+
+      //Function finds slot of a cell key, or the empty slot the key would be placed in (linear probing, table size is a power of 2)
+      int findSlot(uint64_t key){
+         uint64_t mask = slots.size() - 1;
+         uint64_t slotIter = (key * 0x9E3779B97F4A7C15ULL) >> 20 & mask;
+         while(slots[slotIter].head != -1 && slots[slotIter].key != key){
+            slotIter = (slotIter + 1) & mask;
+         }
+         return slotIter;
+      }
+
+      //Function doubles table size and places occupied cells again
+      void grow(){
+         vector<gridSlot> oldSlots;
+         oldSlots.swap(slots);
+         gridSlot empty;
+         empty.key = 0;
+         empty.head = -1;
+         empty.tail = -1;
+         slots.assign(max((size_t)64, 2*oldSlots.size()), empty);
+         for(int slotIter = 0; slotIter < oldSlots.size(); slotIter++){
+            if(oldSlots[slotIter].head != -1){
+               slots[findSlot(oldSlots[slotIter].key)] = oldSlots[slotIter];
+            }
+         }
+      }
+
+      double cellSize;                 //Size of a cell along y and z axis
+      double xCellSize;                //Size of a cell along x axis (cell size, widened if x axis wraps)
+      int64_t xCellsAround;            //Amount of x cells around wrap period, 0 if x axis does not wrap
+      int cellCount;                   //Amount of occupied cells
+      vector<gridSlot> slots;          //Open addressing table of cells
+      vector<int> entryIDs;            //ID of each entry, entries in insertion order
+      vector<int> entryNext;           //Next entry of same cell, -1 at end of cell
+};
+
+//Position of a track prediction or measurement
+struct associationPoint {
+   double xyz[3];       //Site relative cartesian position. (meters)
+};
+
+class trackAssociator {
+   public:
+      trackAssociator(){
+         gate = 1000; //1 km validation gate by default
+      }
+      ~trackAssociator(){}
+
+      //Sets validation gate, largest distance between a track's predicted position and a measurement assigned to it
+      //Unit: meters
+      void setGate(double meters){
+         gate = meters;
+      }
+
+      //Gets validation gate
+      //Unit: meters
+      double getGate(){
+         return gate;
+      }
+
+      //Function sizes storage for scans of up to pointCount tracks and as many measurements, so association does not allocate
+      void reserve(int pointCount){
+         measurementGrid.reserve(pointCount);
+         trackGrid.reserve(pointCount);
+         trackPoints.reserve(pointCount);
+         pairs.reserve(4*pointCount); //Gated pairs, a few per track
+         candidates.reserve(pointCount);
+         measurementUsed.reserve(pointCount);
+      }
+
+      //Function assigns measurements to tracks (global-nearest-neighbor within validation gates)
+      //Inputs: tracks = predicted track positions. measurements = measurement positions.
+      //Output: trackAssignment = measurement assigned to each track, -1 if none
+      void assign(const vector<associationPoint> &tracks, const vector<associationPoint> &measurements, vector<int> &trackAssignment){
+         trackAssignment.assign(tracks.size(), -1);
+         measurementGrid.reset(gate);
+         for(int measIter = 0; measIter < measurements.size(); measIter++){
+            measurementGrid.insert(measIter, measurements[measIter].xyz[0], measurements[measIter].xyz[1], measurements[measIter].xyz[2]);
+         }
+
+         //Gated candidate pairs from grid
+         pairs.clear();
+         for(int trackIter = 0; trackIter < tracks.size(); trackIter++){
+            measurementGrid.query(tracks[trackIter].xyz[0], tracks[trackIter].xyz[1], tracks[trackIter].xyz[2], candidates);
+            for(int candidateIter = 0; candidateIter < candidates.size(); candidateIter++){
+               double distance = squaredDistance(tracks[trackIter], measurements[candidates[candidateIter]]);
+               if(distance <= gate*gate){
+                  associationPair pair;
+                  pair.cost = distance;
+                  pair.track = trackIter;
+                  pair.measurement = candidates[candidateIter];
+                  pairs.push_back(pair);
+               }
+            }
+         }
+
+         //Nearest pairs first, each track/measurement used once
+         sort(pairs.begin(), pairs.end(), comparePairs);
+         measurementUsed.assign(measurements.size(), false);
+         for(int pairIter = 0; pairIter < pairs.size(); pairIter++){
+            const associationPair &pair = pairs[pairIter];
+            if(trackAssignment[pair.track] == -1 && measurementUsed[pair.measurement] == false){
+               trackAssignment[pair.track] = pair.measurement;
+               measurementUsed[pair.measurement] = true;
+            }
+         }
+      }
+
+      //Function empties tracks used by findTrack()
+      void resetTracks(){
+         trackGrid.reset(gate);
+         trackPoints.clear();
+      }
+
+      //Function adds a track position used by findTrack(). Returns ID of track in findTrack() results
+      int addTrack(const double xyz[3]){
+         associationPoint point;
+         for(int i = 0; i < 3; i++){
+            point.xyz[i] = xyz[i];
+         }
+         trackGrid.insert(trackPoints.size(), xyz[0], xyz[1], xyz[2]);
+         trackPoints.push_back(point);
+         return trackPoints.size() - 1;
+      }
+
+      //Function finds nearest track added by addTrack() whose gate contains a measurement. Returns -1 if none
+      int findTrack(const double xyz[3]){
+         associationPoint measurement;
+         for(int i = 0; i < 3; i++){
+            measurement.xyz[i] = xyz[i];
+         }
+         trackGrid.query(xyz[0], xyz[1], xyz[2], candidates);
+         int nearest = -1;
+         double nearestDistance = gate*gate;
+         for(int candidateIter = 0; candidateIter < candidates.size(); candidateIter++){
+            double distance = squaredDistance(trackPoints[candidates[candidateIter]], measurement);
+            if(distance < nearestDistance || (distance == nearestDistance && nearest == -1)){
+               nearest = candidates[candidateIter];
+               nearestDistance = distance;
+            }
+         }
+         return nearest;
+      }
+
+   private:
+      //Gated track/measurement pair
+      struct associationPair {
+         double cost;         //Squared distance. (meters^2)
+         int track;
+         int measurement;
+      };
+
+      //Orders pairs by cost, ties by track then measurement so assignment does not depend on sort implementation
+      static bool comparePairs(const associationPair &first, const associationPair &second){
+         if(first.cost != second.cost){
+            return first.cost < second.cost;
+         }
+         if(first.track != second.track){
+            return first.track < second.track;
+         }
+         return first.measurement < second.measurement;
+      }
+
+      static double squaredDistance(const associationPoint &first, const associationPoint &second){
+         double dx = first.xyz[0] - second.xyz[0];
+         double dy = first.xyz[1] - second.xyz[1];
+         double dz = first.xyz[2] - second.xyz[2];
+         return dx*dx + dy*dy + dz*dz;
+      }
+
+      double gate;                           //Validation gate. (meters)
+      spatialGrid measurementGrid;           //Measurements of current scan
+      spatialGrid trackGrid;                 //Track positions used by findTrack()
+      vector<associationPoint> trackPoints;  //Track positions used by findTrack()
+      vector<associationPair> pairs;         //Gated pairs of current scan
+      vector<int> candidates;                //IDs returned by grid query
+      vector<bool> measurementUsed;          //Determines if measurement is already assigned
+};
+
+#endif
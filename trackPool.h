@@ -0,0 +1,256 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: trackPool.h contains the track profiles of a radar and their lifecycle. A track starts tentative on a search
+ *              detection and becomes confirmed when its confirmation beam detects the target.
+ *              By default a confirmed track is lost on its first missed track beam and, like a tentative track whose
+ *              confirmation beam missed, is parked inactive: it no longer receives track beams, and a later search detection
+ *              of its target sends it a confirmation beam instead of starting a new track, returning it to service if the
+ *              beam detects the target (unpark()).
+ *              With coast rules set (setCoastRules()) a confirmed track coasts through missed track beams while the rules
+ *              allow, its prediction carried forward (tracker::coast()), and is then lost and dropped; a tentative track
+ *              whose confirmation beam misses is dropped right away. Tracks kept by measurement association are always
+ *              dropped when lost. Only tentative, confirmed and coasting tracks are kept in the dense active list the radar
+ *              services every frame, inactive tracks are kept in a separate parked list only searched when a search detection
+ *              is matched to a track (findLive()), and dropped trackers are recycled by later tracks instead of being freed.
+ *              Coast rules: a track is lost once more than maxCoastBeams consecutive track beams missed, or once
+ *              maxCoastTime has passed since its last detection.
+ *              Dropping and parking are deferred: dropped and lost tracks leave the active list at the next compact(), so the
+ *              list can be iterated while tracks are dropped or lost, and a tracker is only recycled after it left its list.
+ *              Trackers and list storage can be allocated ahead of time (reserve()), so starting a track does not allocate.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TRACKPOOL_H
+#define TRACKPOOL_H
+#include "tracker.h"
+#include "target.h"
+#include <vector>
+#include <math.h>
+
+using namespace std;
+
+class trackPool {
+   public:
+      trackPool(){
+         maxCoastBeams = 0;         //tracks are lost on first missed track beam by default
+         maxCoastTime = HUGE_VAL;
+         dropLostTracks = false;    //lost tracks stay in service by default
+         recycledCount = 0;
+         pendingDrops = false;
+         pendingParkedDrops = false;
+      }
+      ~trackPool(){
+         //Pool owns every tracker it created
+         for(int slotIter = 0; slotIter < slots.size(); slotIter++){
+            delete slots[slotIter];
+         }
+      }
+      trackPool(const trackPool&) = delete;
+      trackPool& operator=(const trackPool&) = delete;
+
+      //Sets coast rules, consecutive missed track beams a confirmed track survives and longest time without a detection. Tracks lost
+      //once the rules run out, and tentative tracks whose confirmation beam missed, are dropped
+      //Units: seconds
+      void setCoastRules(int beams, double coastTime){
+         maxCoastBeams = beams;
+         maxCoastTime = coastTime;
+         dropLostTracks = true;
+      }
+
+      //Gets bool determining if lost and unconfirmed tracks are dropped (coast rules set) instead of parked inactive
+      bool dropsLostTracks(){
+         return dropLostTracks;
+      }
+
+      //Function allocates trackers and track list storage ahead of time for trackCount live tracks, so starting the first trackCount
+      //tracks does not allocate
+      void reserve(int trackCount){
+         slots.reserve(trackCount);
+         active.reserve(trackCount);
+         parked.reserve(trackCount);
+         freeSlots.reserve(trackCount);
+         spareSlots.reserve(trackCount);
+         double weights[3] = {0, 0, 0};
+         double origin[3] = {0, 0, 0};
+         while(slots.size() < trackCount){
+            tracker* track = new tracker(NULL, 0, weights, 0, 0, origin);
+            track->setState(TRACK_DROPPED);
+            slots.push_back(track);
+            spareSlots.push_back(track);
+         }
+      }
+
+      //Function starts a tentative track on a search detection, recycling a dropped tracker if one is free. With targetOrder, live tracks
+      //are kept in target ID order, otherwise in order started. Returns new track
+      tracker* acquire(target* detectedTarget, double detectedTime, double filterWeights[3], double azPos, double elPos, const double measuredXYZ[3], bool targetOrder){
+         tracker* track;
+         if(freeSlots.empty() == false){
+            track = freeSlots.back();
+            freeSlots.pop_back();
+            track->initialize(detectedTarget, detectedTime, filterWeights, azPos, elPos, measuredXYZ);
+            recycledCount = recycledCount + 1;
+         }
+         else if(spareSlots.empty() == false){
+            track = spareSlots.back();
+            spareSlots.pop_back();
+            track->initialize(detectedTarget, detectedTime, filterWeights, azPos, elPos, measuredXYZ);
+         }
+         else{
+            track = new tracker(detectedTarget, detectedTime, filterWeights, azPos, elPos, measuredXYZ);
+            slots.push_back(track);
+         }
+         insertActive(track, targetOrder);
+         return track;
+      }
+
+      //Function returns a parked (inactive) track to the active list, once its confirmation beam detected the target. With targetOrder,
+      //track is placed in target ID order, otherwise after every live track
+      void unpark(tracker* track, bool targetOrder){
+         for(int trackIter = 0; trackIter < parked.size(); trackIter++){
+            if(parked[trackIter] == track){
+               parked.erase(parked.begin() + trackIter);
+               insertActive(track, targetOrder);
+               return;
+            }
+         }
+      }
+
+      //Function marks a track confirmed after a detection (confirmation or track beam)
+      void recordDetection(tracker* track){
+         track->setState(TRACK_CONFIRMED);
+         track->setMissedBeams(0);
+      }
+
+      //Function applies coast rules to a confirmed/coasting track whose track beam missed. Returns true if track is lost (see lose()),
+      //otherwise track is coasting
+      //Unit: seconds
+      bool recordMiss(tracker* track, double time){
+         track->setMissedBeams(track->getMissedBeams() + 1);
+         if(track->getState() == TRACK_TENTATIVE || track->getMissedBeams() > maxCoastBeams || time - track->getLastDetectTime() > maxCoastTime){
+            return true;
+         }
+         track->setState(TRACK_COASTING);
+         return false;
+      }
+
+      //Function handles a lost (or unconfirmed) active track: dropped with coast rules set, otherwise it is parked inactive until re-confirmed.
+      //Track leaves active list at next compact()
+      void lose(tracker* track){
+         if(dropLostTracks == true){
+            drop(track);
+            return;
+         }
+         track->setState(TRACK_INACTIVE);
+         pendingDrops = true;
+      }
+
+      //Function drops an active or parked track. Track leaves its list at next compact()
+      void drop(tracker* track){
+         if(track->getState() == TRACK_INACTIVE){
+            pendingParkedDrops = true;
+         }
+         else{
+            pendingDrops = true;
+         }
+         track->setState(TRACK_DROPPED);
+      }
+
+      //Function moves lost tracks from active list to parked list, removes dropped tracks from both lists (keeping order of live tracks)
+      //and frees their trackers for recycling
+      void compact(){
+         if(pendingDrops == true){
+            int kept = 0;
+            for(int trackIter = 0; trackIter < active.size(); trackIter++){
+               if(active[trackIter]->getState() == TRACK_DROPPED){
+                  freeSlots.push_back(active[trackIter]);
+               }
+               else if(active[trackIter]->getState() == TRACK_INACTIVE){
+                  parked.push_back(active[trackIter]);
+               }
+               else{
+                  active[kept] = active[trackIter];
+                  kept = kept + 1;
+               }
+            }
+            active.resize(kept);
+            pendingDrops = false;
+         }
+         if(pendingParkedDrops == true){
+            int kept = 0;
+            for(int trackIter = 0; trackIter < parked.size(); trackIter++){
+               if(parked[trackIter]->getState() == TRACK_DROPPED){
+                  freeSlots.push_back(parked[trackIter]);
+               }
+               else{
+                  parked[kept] = parked[trackIter];
+                  kept = kept + 1;
+               }
+            }
+            parked.resize(kept);
+            pendingParkedDrops = false;
+         }
+      }
+
+      //Function finds live (active or parked) track of a target, NULL if target has none
+      tracker* findLive(target* trackedTarget){
+         for(int trackIter = 0; trackIter < active.size(); trackIter++){
+            if(active[trackIter]->getTarget() == trackedTarget && active[trackIter]->getState() != TRACK_DROPPED){
+               return active[trackIter];
+            }
+         }
+         for(int trackIter = 0; trackIter < parked.size(); trackIter++){
+            if(parked[trackIter]->getTarget() == trackedTarget && parked[trackIter]->getState() != TRACK_DROPPED){
+               return parked[trackIter];
+            }
+         }
+         return NULL;
+      }
+
+      //Gets active list, tentative/confirmed/coasting tracks in service order (may hold tracks dropped or lost since last compact())
+      const vector<tracker*>& getActive(){
+         return active;
+      }
+
+      //Gets parked list, inactive tracks waiting for re-confirmation (may hold tracks dropped since last compact())
+      const vector<tracker*>& getParked(){
+         return parked;
+      }
+
+      //Gets amount of trackers allocated (live, dropped or free)
+      int getSlotCount(){
+         return slots.size();
+      }
+
+      //Gets amount of tracks started in a recycled tracker
+      long getRecycledCount(){
+         return recycledCount;
+      }
+
+   private:
+      //Function adds a track to active list, in target ID order with targetOrder, otherwise after every live track
+      void insertActive(tracker* track, bool targetOrder){
+         if(targetOrder == true){
+            int trackIter = active.size();
+            while(trackIter > 0 && active[trackIter-1]->getTarget()->getTargetID() > track->getTarget()->getTargetID()){
+               trackIter = trackIter - 1;
+            }
+            active.insert(active.begin() + trackIter, track);
+            return;
+         }
+         active.push_back(track);
+      }
+
+      vector<tracker*> slots;       //Every tracker allocated by pool
+      vector<tracker*> active;      //Tentative, confirmed and coasting tracks in service order
+      vector<tracker*> parked;      //Inactive tracks, serviced only when a search detection re-confirms them
+      vector<tracker*> freeSlots;   //Trackers of dropped tracks, reused by next tracks started
+      vector<tracker*> spareSlots;  //Trackers allocated ahead of time (reserve()) and not yet used
+      int maxCoastBeams;            //Consecutive missed track beams a track survives
+      double maxCoastTime;          //Longest time a track survives without a detection. (seconds)
+      bool dropLostTracks;          //Lost/unconfirmed tracks are dropped instead of kept in service inactive
+      long recycledCount;           //Tracks started in a recycled tracker
+      bool pendingDrops;            //Active tracks were dropped or lost since last compact()
+      bool pendingParkedDrops;      //Parked tracks were dropped since last compact()
+};
+
+#endif
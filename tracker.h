@@ -1,52 +1,75 @@
 /*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
  * Unclassified
  * Coder: Weston Yohe
- * Last Modified: 8/11/2022
+ * Last Modified: 10/19/2026
  * Description: tracker.h contains the logic for the current radar tracking algorithm/method. Currently, the simulation
  *              uses a simple alpha-beta-gamma algorithm (due to the constant trajectory of targets currently) to predict
  *              target's locations, once detected. The class estimates target's current location and predicts
  *              the next location. The neccassry scanning position (azimuth,elevation) is then calculated from
  *              prediction.
+ *              Every track has a lifecycle state (tentative, confirmed, coasting, inactive, dropped), managed by the radar's
+ *              track pool (trackPool.h), which recycles trackers of dropped tracks. A coasting track's prediction is carried
+ *              forward to its next track beam on every miss (coast()).
  *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifndef TRACKER_H
 #define TRACKER_H
 #include "utility.h"
+#include "precision.h"
 #include "target.h"
 #include "radar.h"
 #include <iostream>
 
 using namespace std;
 
+//Track lifecycle states
+enum trackState {
+   TRACK_TENTATIVE = 0,    //Search detection, confirmation beam not yet sent/successful
+   TRACK_CONFIRMED = 1,    //Confirmed, last track beam detected target
+   TRACK_COASTING = 2,     //Confirmed, missed track beam(s) but kept by coast rules
+   TRACK_INACTIVE = 3,     //Lost, parked without track beams until a search detection re-confirms it (default, without track coasting)
+   TRACK_DROPPED = 4       //No longer serviced, tracker may be recycled
+};
+
 class tracker {
     public:
-        tracker(target* detectedTarget, double detectedTime, double filterWeights[3], double azPos, double elPos){
-            //Inputs: detectedTarget = target detected in search beam.
-                      //detectedTime = time target was detected in search (seconds)
-                      //filterWegihts = filter/algorithm weights. 0 = alpha, 1 = beta, 2 = gamma. (unitless)
-                      //azPos = current azimuth scanning position to detect target. (degrees)
-                      //elPos = current elevation scanning position to detect target. (degrees)
-
+        tracker(target* detectedTarget, double detectedTime, double filterWeights[3], double azPos, double elPos, const double measuredXYZ[3]){
+            initialize(detectedTarget, detectedTime, filterWeights, azPos, elPos, measuredXYZ);
+        } 
+        ~tracker(){}
 
+    //Function (re)initializes tracking profile on a search detection, also used to recycle a dropped tracker
+    //Inputs: detectedTarget = target detected in search beam.
+              //detectedTime = time target was detected in search (seconds)
+              //filterWegihts = filter/algorithm weights. 0 = alpha, 1 = beta, 2 = gamma. (unitless)
+              //azPos = current azimuth scanning position to detect target. (degrees)
+              //elPos = current elevation scanning position to detect target. (degrees)
+              //measuredXYZ = radar site relative cartesian position of detected target. (meters)
+    void initialize(target* detectedTarget, double detectedTime, double filterWeights[3], double azPos, double elPos, const double measuredXYZ[3]){
             detection = true;               //Initial detection bool from search detection
-            activeTrack = false;            //Confirmation beam has not yet confirmed detected taraget
-            target = detectedTarget;        //Detected target
-            detectedTime = initial_current_time[0]; //Initial time detected
+            state = TRACK_TENTATIVE;        //Confirmation beam has not yet confirmed detected taraget
+            missedBeams = 0;
+            trackedTarget = detectedTarget; //Detected target
+            initial_current_time[0] = detectedTime; //Initial time detected
+            predictedTime = detectedTime;   //Estimation is of detected position
             nextScanPosition[0] = azPos;    //detected azimuth beam position
             nextScanPosition[1] = elPos;    //detected elevation beam position
 
             for(int i = 0; i < 3; i++){
                  A_B_GammaWeights[i] = filterWeights[i]; //Setting filter/algorithm weights
-                 targetDetectXYZ[i] = target->getCoordXYZ(i); //Initializing initial detected target cartesian coordinates
+                 targetDetectXYZ[i] = measuredXYZ[i]; //Initializing initial detected target cartesian coordinates
+                 currXYZ[i] = targetDetectXYZ[i];              //Initializing filter state so estimations do not start from garbage values
+                 estXYZ[i] = targetDetectXYZ[i];
+                 currVxVyVz[i] = 0;
+                 currAxAyAz[i] = 0;
+                 estVxVyVz[i] = 0;
+                 estAxAyAz[i] = 0;
             }
-            
-            
-        } 
-        ~tracker(){}
+    }
 
     //Function intializes tracking filter to give a rough estimation on targets next cartesian and spherical position
-    //Units: seconds
+    //Inputs: time = confirmation beam time (seconds). measuredXYZ = radar site relative cartesian position of target (meters)
     //TO_DO: Rearrange confirmation scanning beam timing so assumedValuesCalculation() can provide actual assumed velocity and acceleration values
-    void filterInit(double time){
+    void filterInit(double time, const double measuredXYZ[3]){
         
         initial_current_time[1] = time;
         double deltaTime = initial_current_time[1] - initial_current_time[0]; //Displacement from first detection to confirmation beam
@@ -54,14 +77,14 @@ class tracker {
 
         //Gathering target coordinates to determine rough assumed velocity and acceleration values 
         for(int iter = 0; iter < 3; iter++){
-            targetConfirmXYZ[iter] = target->getCoordXYZ(iter);
+            targetConfirmXYZ[iter] = measuredXYZ[iter];
         }
         assumedValuesCalculation(deltaTime); //Calling function to calculate assumed values
         
         //Assumed values to be used in initializing tracking logic
          double assumedVel[3] = {estVxVyVz[0],estVxVyVz[1],estVxVyVz[2]};
          double assumedAcc[3] = {estAxAyAz[0],estAxAyAz[1],estAxAyAz[2]};
-         double currXYZ[3] = {target->getCoordXYZ(0), target->getCoordXYZ(1), target->getCoordXYZ(2)}; //Current target cartesian coordinates
+         double currXYZ[3] = {measuredXYZ[0], measuredXYZ[1], measuredXYZ[2]}; //Current target cartesian coordinates
         
         
          //Estimating the targets rough next position from assumed values and displacement in time
@@ -87,19 +110,19 @@ class tracker {
          for(int i = 0; i < 3; i++){
             nextScanPosition[i] = convertPolar[i];
          }
+         predictedTime = time;
       }
       
       
       //Function updates tracking alogrithm to predict targets next cartesian position. Due to the nature of the filter, the more updates the filter recevives, the more precise target estimations become.
-      //Units: seconds
+      //Inputs: time = track beam time (seconds). measuredXYZ = radar site relative "measured" cartesian position of target (meters)
       //TO-DO: Change "measure" coordinates to scanning poistions spherical coordiantes converted to cartesian coordinates
-      void updateFilter(double time){
+      void updateFilter(double time, const double measuredXYZ[3]){
         estXYZtoCurrXYZ(); //Converts future predictions as current target position estimations
         initial_current_time[1] = time; //Making current time the "final" time for time displacement calculations
         double deltaTime = initial_current_time[1] - initial_current_time[0]; //Setting time displacement from last track detection to current track detection.
         initial_current_time[0] = initial_current_time[1]; //Moves final detection time to initial detection time for future detections
 
-        double measuredXYZ[3] = {target->getCoordXYZ(0), target->getCoordXYZ(1), target->getCoordXYZ(2)}; //"measured" target coordinates. 
             
          //Estimating targets next cartesian position, velocity and acceleration components using tracking filters
          for(int i = 0; i < 3; i++){
@@ -120,7 +143,28 @@ class tracker {
          for(int i = 0; i < 3; i++){
             nextScanPosition[i] = convertPolar[i];
          }
-         
+         predictedTime = time;
+      }
+
+      //Function carries the filter's prediction forward without a measurement, for a track beam that missed. Estimated position and
+      //velocity are propagated from the time of the last prediction to the next track beam, and the next scanning position follows
+      //Input: nextBeamTime = time of track's next track beam (seconds)
+      void coast(double nextBeamTime){
+         double deltaTime = nextBeamTime - predictedTime;
+         for(int i = 0; i < 3; i++){
+            estXYZ[i] = estXYZ[i] + estVxVyVz[i]*deltaTime + 0.5*estAxAyAz[i]*deltaTime*deltaTime;
+            estVxVyVz[i] = estVxVyVz[i] + estAxAyAz[i]*deltaTime;
+         }
+         double convertPolar[3];
+         for(int i = 0; i < 3; i++){
+            convertPolar[i] = estXYZ[i];
+         }
+         utility::rectToPolarRads(convertPolar);
+         utility::radsToDeg(convertPolar);
+         for(int i = 0; i < 3; i++){
+            nextScanPosition[i] = convertPolar[i];
+         }
+         predictedTime = nextBeamTime;
       }
 
         //Gets scanning position of track beam
@@ -130,14 +174,35 @@ class tracker {
             return nextScanPosition[iter];
         }
 
-        //Sets active track bool so begin tracking process
-        void setActiveTrackBool(bool logic){
-            activeTrack = logic;
+        //Sets lifecycle state of track
+        void setState(trackState trackLifecycleState){
+            state = trackLifecycleState;
         }
 
-        //Gets active track bool which determines if tracking profile is in current track
+        //Gets lifecycle state of track
+        trackState getState(){
+            return state;
+        }
+
+        //Gets active track bool which determines if tracking profile is in current track (confirmed or coasting)
         bool getActivTrackBool(){
-            return activeTrack;
+            return state == TRACK_CONFIRMED || state == TRACK_COASTING;
+        }
+
+        //Sets amount of consecutive track beams that missed target
+        void setMissedBeams(int count){
+            missedBeams = count;
+        }
+
+        //Gets amount of consecutive track beams that missed target
+        int getMissedBeams(){
+            return missedBeams;
+        }
+
+        //Gets time of track's last detection (search, confirmation or track beam)
+        //Unit: seconds
+        double getLastDetectTime(){
+            return initial_current_time[0];
         }
 
         //Converts future cartesian position estimation to current cartesian position estimation
@@ -149,7 +214,20 @@ class tracker {
 
         //Gets target object which is being tracked
         target* getTarget(){
-            return target;
+            return trackedTarget;
+        }
+
+        //Sets target object which is being tracked. With measurement association this is the truth target of the last measurement
+        //assigned to the track
+        void setTarget(target* measuredTarget){
+            trackedTarget = measuredTarget;
+        }
+
+        //Gets estimation on targets next cartesian position, used as track's predicted position when gating measurements
+        //Input: 0 = x-position, 1 = y-position, 2 = z-position
+        //Unit: meters
+        double getEstimatedXYZ(int iter){
+            return estXYZ[iter];
         }
 
 
@@ -159,6 +237,11 @@ class tracker {
         //TO-DO: Currently reduntant due to instananeous confirmation beam after searach detection->target has no displacement under current conditions
         void assumedValuesCalculation(double deltaTime){
             for(int iter = 0; iter < 3; iter++){
+                if(deltaTime <= 0){ //Instantaneous confirmation beam, no displacement to estimate from
+                    estVxVyVz[iter] = 0;
+                    estAxAyAz[iter] = 0;
+                    continue;
+                }
                 double displacement = targetConfirmXYZ[iter] - targetConfirmXYZ[iter];
                 estVxVyVz[iter] = displacement / deltaTime;
                 estAxAyAz[iter] = (2*(displacement - (estVxVyVz[iter]*deltaTime))) / (deltaTime * deltaTime);
@@ -168,19 +251,21 @@ class tracker {
 
         private:
         bool detection;     //Used to determine initial search detection on target
-        bool activeTrack;   //Determines if tracker is actively in traack
-        target* target;     //The target the tracker is traacking
+        trackState state;   //Lifecycle state of track
+        int missedBeams;    //Consecutive track beams that missed target
+        target* trackedTarget; //The target the tracker is traacking
         double initial_current_time[2]; //Start and stop times used for time displacement arithmetic. 0 = initial time. 1 = final time (relative refrence). (seconds)
-        double currXYZ[3];      //Current estimation on targets cartesian coordinates. 0 = x-position. 1 = y-position. 2 = z-position. (meters)
-        double currVxVyVz[3];   //Current estimation on targets velcoity components. 0 = x-velocity. 1 = y-velocity. 2 = z-velocity. (m/s)
-        double currAxAyAz[3];   //Current estimation on targets velcoity components. 0 = x-acceleration. 1 = y-acceleration. 2 = z-acceleration. (m/s^2)
-        double estXYZ[3];       //Estimation on targets next cartesian coordinates. 0 = x-position. 1 = y-position. 2 = z-position. (meters)
-        double estVxVyVz[3];    //Estimation on targets next velcoity components. 0 = x-velocity. 1 = y-velocity. 2 = z-velocity. (m/s)
-        double estAxAyAz[3];    //Estimation on targets next acceleration components. 0 = x-acceleration. 1 = y-acceleration. 2 = z-acceleration. (m/s^2)
-        double nextScanPosition[3]; //Spherical scanning position from estimation on targets next cartesian coordinates. 0 = azimuth position(degrees). 1 = elevation position(degrees). 2 = range(not used)(meters)
-        double A_B_GammaWeights[3]; //Tracking weights. 0 = alpha. 1 = beta. 2 = gamma. (unitless)
-        double targetDetectXYZ[3];  //Target's initial detected cartestian position. 0 = x-position. 1 = y-position. 2 = z-position. (meters)
-        double targetConfirmXYZ[3]; //Target's confirmed cartestian position. 0 = x-position. 1 = y-position. 2 = z-position. (meters)
+        double predictedTime;   //Time estimated position/next scanning position are predicted for. (seconds)
+        stateReal currXYZ[3];   //Current estimation on targets cartesian coordinates. 0 = x-position. 1 = y-position. 2 = z-position. (meters)
+        stateReal currVxVyVz[3];   //Current estimation on targets velcoity components. 0 = x-velocity. 1 = y-velocity. 2 = z-velocity. (m/s)
+        stateReal currAxAyAz[3];   //Current estimation on targets velcoity components. 0 = x-acceleration. 1 = y-acceleration. 2 = z-acceleration. (m/s^2)
+        stateReal estXYZ[3];    //Estimation on targets next cartesian coordinates. 0 = x-position. 1 = y-position. 2 = z-position. (meters)
+        stateReal estVxVyVz[3]; //Estimation on targets next velcoity components. 0 = x-velocity. 1 = y-velocity. 2 = z-velocity. (m/s)
+        stateReal estAxAyAz[3]; //Estimation on targets next acceleration components. 0 = x-acceleration. 1 = y-acceleration. 2 = z-acceleration. (m/s^2)
+        stateReal nextScanPosition[3]; //Spherical scanning position from estimation on targets next cartesian coordinates. 0 = azimuth position(degrees). 1 = elevation position(degrees). 2 = range(not used)(meters)
+        stateReal A_B_GammaWeights[3]; //Tracking weights. 0 = alpha. 1 = beta. 2 = gamma. (unitless)
+        stateReal targetDetectXYZ[3];  //Target's initial detected cartestian position. 0 = x-position. 1 = y-position. 2 = z-position. (meters)
+        stateReal targetConfirmXYZ[3]; //Target's confirmed cartestian position. 0 = x-position. 1 = y-position. 2 = z-position. (meters)
         
 };
 
@@ -0,0 +1,170 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: trajectoryTarget.h contains a target which plays back a recorded trajectory instead of constant
+ *              acceleration kinematics. Waypoints are read directly from a memory-mapped waypoint file (waypointFile.h)
+ *              and position/velocity are interpolated between waypoints with a cubic Hermite spline, which matches both
+ *              recorded positions and velocities. The target caches the segment used by its last query, so sequential
+ *              queries (the simulation always moves forward in time) cost O(1); jumps fall back to a binary search.
+ *              The cached segment is only a hint and is kept in a relaxed atomic, so radar sites running on different
+ *              threads can query one shared target without locking (a stale hint only costs a binary search).
+ *              Outside of its recorded time span a trajectory target does not exist and cannot be detected.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TRAJECTORYTARGET_H
+#define TRAJECTORYTARGET_H
+#include "target.h"
+#include "waypointFile.h"
+#include <atomic>
+
+using namespace std;
+
+class trajectoryTarget : public target {
+    public:
+        //Inputs: waypoints = track's waypoints inside a waypoint file mapping. count = amount of waypoints. targetRCS = RCS (dBm^2)
+        trajectoryTarget(const waypoint* waypoints, size_t count, double targetRCS){
+            waypointTable = waypoints;
+            waypointCount = count;
+            cursor.store(0, memory_order_relaxed);
+            setRCS(targetRCS * units::dB);
+
+            //Starting position/velocity are the first recorded waypoint
+            double startKm[3];
+            for(int i = 0; i < 3; i++){
+                startKm[i] = utility::baseToKilo(waypointTable[0].xyz[i]);
+            }
+            setStartTime(waypointTable[0].time);
+            initializePOS(startKm);
+            setVelocityVector(waypointTable[0].vel[0], waypointTable[0].vel[1], waypointTable[0].vel[2]);
+            setAccelerationVector(0, 0, 0);
+        }
+        ~trajectoryTarget(){}
+
+        //Function interpolates recorded position and velocity at an absolute simulation time. Times outside the recorded
+        //span are held at the first/last waypoint
+        //Inputs: time = simulation time (seconds). xyz = output position (meters). vel = output velocity (m/s)
+        void getStateAt(double time, double xyz[3], double vel[3]){
+            if(waypointCount == 1 || time <= waypointTable[0].time || time >= waypointTable[waypointCount-1].time){
+                const waypoint &held = (time <= waypointTable[0].time) ? waypointTable[0] : waypointTable[waypointCount-1];
+                for(int i = 0; i < 3; i++){
+                    xyz[i] = held.xyz[i];
+                    vel[i] = held.vel[i];
+                }
+                return;
+            }
+
+            size_t segment = findSegment(time);
+            const waypoint &first = waypointTable[segment];
+            const waypoint &second = waypointTable[segment+1];
+
+            //Cubic Hermite basis functions and derivatives over normalized segment time
+            double length = second.time - first.time;
+            double s = (time - first.time) / length;
+            double s2 = s*s;
+            double s3 = s2*s;
+            double h00 = 2*s3 - 3*s2 + 1;
+            double h10 = s3 - 2*s2 + s;
+            double h01 = -2*s3 + 3*s2;
+            double h11 = s3 - s2;
+            double dh00 = 6*s2 - 6*s;
+            double dh10 = 3*s2 - 4*s + 1;
+            double dh01 = -6*s2 + 6*s;
+            double dh11 = 3*s2 - 2*s;
+            for(int i = 0; i < 3; i++){
+                xyz[i] = h00*first.xyz[i] + h10*length*first.vel[i] + h01*second.xyz[i] + h11*length*second.vel[i];
+                vel[i] = (dh00*first.xyz[i] + dh01*second.xyz[i])/length + dh10*first.vel[i] + dh11*second.vel[i];
+            }
+        }
+
+        //Function determines if target exists at an absolute simulation time (inside recorded time span)
+        //Unit: seconds
+        bool isActiveAt(double time){
+            return time >= waypointTable[0].time && time <= waypointTable[waypointCount-1].time;
+        }
+
+        //Function determines if target exists at any time within [time, time+window] (recorded time span overlaps window)
+        //Units: seconds
+        bool isActiveDuring(double time, double window){
+            return time + window >= waypointTable[0].time && time <= waypointTable[waypointCount-1].time;
+        }
+
+        //Function gives an upper bound on the distance target can travel within [time, time+window], used for range culling.
+        //Each Hermite segment is a cubic Bezier curve with control points p0, p0 + v0*length/3, p1 - v1*length/3, p1 and lies
+        //inside their convex hull, so the farthest control point of every segment overlapping the window from the position
+        //at time bounds the displacement, including any overshoot of the spline between waypoints
+        //Units: seconds, output in meters
+        double getMaxDisplacement(double time, double window){
+            if(waypointCount == 1 || time >= waypointTable[waypointCount-1].time || time + window <= waypointTable[0].time){
+                return 0; //Target is held in place outside its recorded time span
+            }
+            double xyz[3];
+            double vel[3];
+            getStateAt(time, xyz, vel); //Held at first waypoint before recorded time span
+            size_t segment = (time <= waypointTable[0].time) ? 0 : findSegment(time);
+            double maxDistance = 0;
+            for(; segment < waypointCount-1 && waypointTable[segment].time <= time + window; segment++){
+                const waypoint &first = waypointTable[segment];
+                const waypoint &second = waypointTable[segment+1];
+                double length = second.time - first.time;
+                double control[4][3];
+                for(int i = 0; i < 3; i++){
+                    control[0][i] = first.xyz[i];
+                    control[1][i] = first.xyz[i] + first.vel[i]*length/3;
+                    control[2][i] = second.xyz[i] - second.vel[i]*length/3;
+                    control[3][i] = second.xyz[i];
+                }
+                for(int point = 0; point < 4; point++){
+                    double distance = sqrt(pow(control[point][0] - xyz[0],2) + pow(control[point][1] - xyz[1],2) + pow(control[point][2] - xyz[2],2));
+                    maxDistance = max(maxDistance, distance);
+                }
+            }
+            return maxDistance;
+        }
+
+        //Gets amount of recorded waypoints
+        size_t getWaypointCount(){
+            return waypointCount;
+        }
+
+    private:
+        //Function finds segment [segment, segment+1] containing time. Checks cached segment and the next few segments first,
+        //which covers sequential queries in O(1), otherwise binary searches the waypoint table
+        //Unit: seconds
+        size_t findSegment(double time){
+            size_t last = waypointCount - 2;        //Last valid segment
+            size_t hint = cursor.load(memory_order_relaxed);
+            if(hint > last){
+                hint = last;
+            }
+            if(waypointTable[hint].time <= time){
+                for(int step = 0; step < 4 && hint <= last; step++){
+                    if(time < waypointTable[hint+1].time){
+                        cursor.store(hint, memory_order_relaxed);
+                        return hint;
+                    }
+                    hint = hint + 1;
+                }
+            }
+
+            //Binary search for last waypoint with waypoint time <= time
+            size_t low = 0;
+            size_t high = last;
+            while(low < high){
+                size_t middle = (low + high + 1) / 2;
+                if(waypointTable[middle].time <= time){
+                    low = middle;
+                }
+                else{
+                    high = middle - 1;
+                }
+            }
+            cursor.store(low, memory_order_relaxed);
+            return low;
+        }
+
+        const waypoint* waypointTable;  //Recorded waypoints inside waypoint file mapping (not owned)
+        size_t waypointCount;           //Amount of recorded waypoints
+        atomic<size_t> cursor;          //Cached segment of last query (hint shared by all querying threads)
+};
+
+#endif
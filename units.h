@@ -0,0 +1,153 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: units.h contains typed quantities for the physical values set on the radar (frequency, power, length,
+ *              angle, decible and time). A quantity holds a plain double in the base unit the simulation computes in (hertz,
+ *              watts, meters, degrees, decible, seconds), so after inlining it costs nothing over a double. Units are typed
+ *              constants (units::GHz, units::km, ...) and literals (2.5_GHz, 30_m), conversions are constexpr and fold at
+ *              compile time:
+ *                 frequencyValue freq = 2.5_GHz;         //2.5e9 hertz
+ *                 double kHz = freq / units::kHz;        //Value in a unit is a division by that unit
+ *              Quantities of different kinds do not mix: passing a length where a frequency is expected, adding power to
+ *              length or dividing a power by units::km does not build. Decible values only convert to linear ratios at
+ *              runtime (toLinear()), since pow() is not constexpr.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef UNITS_H
+#define UNITS_H
+#include <math.h>
+
+using namespace std;
+
+//Kinds of quantities, a quantity only combines with quantities of the same kind
+enum unitKind {
+   UNIT_FREQUENCY = 0,  //Base unit hertz
+   UNIT_POWER = 1,      //Base unit watts
+   UNIT_LENGTH = 2,     //Base unit meters
+   UNIT_ANGLE = 3,      //Base unit degrees
+   UNIT_DECIBEL = 4,    //Base unit decible
+   UNIT_TIME = 5        //Base unit seconds
+};
+
+template<unitKind kind>
+class quantity {
+   public:
+      constexpr quantity() : baseValue(0) {}
+
+      //Function makes a quantity from a value in base units
+      static constexpr quantity fromBase(double value){
+         return quantity(value);
+      }
+
+      //Gets value in base units
+      constexpr double base() const {
+         return baseValue;
+      }
+
+      constexpr quantity operator+(quantity other) const { return quantity(baseValue + other.baseValue); }
+      constexpr quantity operator-(quantity other) const { return quantity(baseValue - other.baseValue); }
+      constexpr quantity operator-() const { return quantity(-baseValue); }
+      constexpr quantity operator*(double scale) const { return quantity(baseValue * scale); }
+      constexpr quantity operator/(double scale) const { return quantity(baseValue / scale); }
+      //Ratio of two quantities of same kind, e.g. value in a unit: freq / units::GHz
+      constexpr double operator/(quantity other) const { return baseValue / other.baseValue; }
+
+      constexpr bool operator==(quantity other) const { return baseValue == other.baseValue; }
+      constexpr bool operator!=(quantity other) const { return baseValue != other.baseValue; }
+      constexpr bool operator<(quantity other) const { return baseValue < other.baseValue; }
+      constexpr bool operator<=(quantity other) const { return baseValue <= other.baseValue; }
+      constexpr bool operator>(quantity other) const { return baseValue > other.baseValue; }
+      constexpr bool operator>=(quantity other) const { return baseValue >= other.baseValue; }
+
+   private:
+      constexpr explicit quantity(double value) : baseValue(value) {}
+
+      double baseValue;    //Value in base unit of kind
+};
+
+template<unitKind kind>
+constexpr quantity<kind> operator*(double scale, quantity<kind> value){
+   return value * scale;
+}
+
+typedef quantity<UNIT_FREQUENCY> frequencyValue;
+typedef quantity<UNIT_POWER> powerValue;
+typedef quantity<UNIT_LENGTH> lengthValue;
+typedef quantity<UNIT_ANGLE> angleValue;
+typedef quantity<UNIT_DECIBEL> decibelValue;
+typedef quantity<UNIT_TIME> timeValue;
+
+//Units as typed constants, a value in a unit is amount * unit
+struct units {
+   static constexpr double pi = 3.14159265358979323846;
+
+   static constexpr frequencyValue Hz = frequencyValue::fromBase(1);
+   static constexpr frequencyValue kHz = frequencyValue::fromBase(1e3);
+   static constexpr frequencyValue MHz = frequencyValue::fromBase(1e6);
+   static constexpr frequencyValue GHz = frequencyValue::fromBase(1e9);
+
+   static constexpr powerValue W = powerValue::fromBase(1);
+   static constexpr powerValue kW = powerValue::fromBase(1e3);
+   static constexpr powerValue MW = powerValue::fromBase(1e6);
+
+   static constexpr lengthValue m = lengthValue::fromBase(1);
+   static constexpr lengthValue km = lengthValue::fromBase(1e3);
+
+   static constexpr angleValue deg = angleValue::fromBase(1);
+   static constexpr angleValue rad = angleValue::fromBase(180/pi);
+
+   static constexpr decibelValue dB = decibelValue::fromBase(1);
+
+   static constexpr timeValue ms = timeValue::fromBase(1e-3);
+   static constexpr timeValue s = timeValue::fromBase(1);
+   static constexpr timeValue min = timeValue::fromBase(60);
+};
+
+//Literals, e.g. 2.5_GHz, 150_m, 45_deg
+constexpr frequencyValue operator"" _Hz(long double value){ return (double)value * units::Hz; }
+constexpr frequencyValue operator"" _Hz(unsigned long long value){ return (double)value * units::Hz; }
+constexpr frequencyValue operator"" _kHz(long double value){ return (double)value * units::kHz; }
+constexpr frequencyValue operator"" _kHz(unsigned long long value){ return (double)value * units::kHz; }
+constexpr frequencyValue operator"" _MHz(long double value){ return (double)value * units::MHz; }
+constexpr frequencyValue operator"" _MHz(unsigned long long value){ return (double)value * units::MHz; }
+constexpr frequencyValue operator"" _GHz(long double value){ return (double)value * units::GHz; }
+constexpr frequencyValue operator"" _GHz(unsigned long long value){ return (double)value * units::GHz; }
+constexpr powerValue operator"" _W(long double value){ return (double)value * units::W; }
+constexpr powerValue operator"" _W(unsigned long long value){ return (double)value * units::W; }
+constexpr powerValue operator"" _kW(long double value){ return (double)value * units::kW; }
+constexpr powerValue operator"" _kW(unsigned long long value){ return (double)value * units::kW; }
+constexpr powerValue operator"" _MW(long double value){ return (double)value * units::MW; }
+constexpr powerValue operator"" _MW(unsigned long long value){ return (double)value * units::MW; }
+constexpr lengthValue operator"" _m(long double value){ return (double)value * units::m; }
+constexpr lengthValue operator"" _m(unsigned long long value){ return (double)value * units::m; }
+constexpr lengthValue operator"" _km(long double value){ return (double)value * units::km; }
+constexpr lengthValue operator"" _km(unsigned long long value){ return (double)value * units::km; }
+constexpr angleValue operator"" _deg(long double value){ return (double)value * units::deg; }
+constexpr angleValue operator"" _deg(unsigned long long value){ return (double)value * units::deg; }
+constexpr angleValue operator"" _rad(long double value){ return (double)value * units::rad; }
+constexpr angleValue operator"" _rad(unsigned long long value){ return (double)value * units::rad; }
+constexpr decibelValue operator"" _dB(long double value){ return (double)value * units::dB; }
+constexpr decibelValue operator"" _dB(unsigned long long value){ return (double)value * units::dB; }
+constexpr timeValue operator"" _ms(long double value){ return (double)value * units::ms; }
+constexpr timeValue operator"" _ms(unsigned long long value){ return (double)value * units::ms; }
+constexpr timeValue operator"" _s(long double value){ return (double)value * units::s; }
+constexpr timeValue operator"" _s(unsigned long long value){ return (double)value * units::s; }
+constexpr timeValue operator"" _min(long double value){ return (double)value * units::min; }
+constexpr timeValue operator"" _min(unsigned long long value){ return (double)value * units::min; }
+
+//Function converts a decible value to a linear power ratio
+inline double toLinear(decibelValue value){
+   return pow(10, value.base()/10);
+}
+
+//Function converts a linear power ratio to a decible value
+inline decibelValue fromLinear(double ratio){
+   return decibelValue::fromBase(10*log10(ratio));
+}
+
+//Conversions fold at compile time
+static_assert(2.5_GHz / units::Hz == 2.5e9, "unit conversion is not constant");
+static_assert(150_m == 0.15_km, "unit conversion is not constant");
+static_assert(2_min / units::s == 120, "unit conversion is not constant");
+
+#endif
@@ -4,7 +4,8 @@
  * Last Modified: 8/10/2022
  * Description: utility.h contains static functions used for unit conversions throughout simulation. The simulation uses base units
  *              for arithmetic along with degree values and decible values. The class serves as a quick and clean method to convert
- *              such units for calculations.
+ *              such units for calculations. Scalar conversions are constexpr and fold at compile time, typed quantities
+ *              (units.h) are preferred for new setters.
  * TO_DO: -Change functions using pass-by-refrence inputs to outputting values using pass-by-value instead
  *        -Delete redundant functions and create a general metric unit conversion function
  *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -14,6 +15,7 @@
 #include <vector>
 #include <ostream>
 #include <string.h>
+#include "units.h"
 using namespace std;
 
 class utility {
@@ -74,63 +76,53 @@ class utility {
     }
 
     //Converts minutes to seconds
-    static double minsToSec(double mins){
-        double sec = mins*60;
-        return sec;
+    static constexpr double minsToSec(double mins){
+        return mins*60;
     }
 
     //Converts miliseconds to seconds
-    static double miliSectoSec(double miliSec){
-        double sec = miliSec/ 1000;
-        return sec;
+    static constexpr double miliSectoSec(double miliSec){
+        return miliSec/ 1000;
     }
 
     //Converts seconds to miliseconds
-    static double secToMiliSec(double sec){
-        double miliSec = sec * 1000;
-        return miliSec;
+    static constexpr double secToMiliSec(double sec){
+        return sec * 1000;
     }
      
     //Converts watts to decible
     static double wattsTodB(double watts){
-        double dB = 10 * log10(watts);
-        return dB;
+        return fromLinear(watts).base();
     }
 
     //Converts decible to watts
     static double dBtoWatts(double dB){
-        double watts = pow(10, dB/10);
-        return watts;
+        return toLinear(dB * units::dB);
     }
 
     //Converts gigahertz to hertz
-    static double GhzToHz(double Ghz){
-        double hz = Ghz * pow(10,9);
-        return hz;
+    static constexpr double GhzToHz(double Ghz){
+        return (Ghz * units::GHz) / units::Hz;
     }
 
     //Converts hertz to gigahertz
-    static double HztoGhz(double hz){
-        double Ghz = hz / pow(10,9);
-    return Ghz;
+    static constexpr double HztoGhz(double hz){
+        return (hz * units::Hz) / units::GHz;
     }
    
     //Converts kilo values to base units
-    static double kiloToBase(double kilo){
-        double base = kilo*1000;
-        return base;
+    static constexpr double kiloToBase(double kilo){
+        return kilo*1000;
     }
 
     //Converts base units to kilo units
-    static double baseToKilo(double base){
-        double kilo = base/1000;
-        return kilo;
+    static constexpr double baseToKilo(double base){
+        return base/1000;
     }
 
     //Converts degrees^2 to steradians 
-    static double degSqToSteraian(double degSq){
-        double steradian = degSq/3283;
-        return steradian;
+    static constexpr double degSqToSteraian(double degSq){
+        return degSq/3283;
     }
 
    private:
@@ -0,0 +1,192 @@
+/*///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ * Unclassified
+ * Coder: Weston Yohe
+ * Last Modified: 10/19/2026
+ * Description: waypointFile.h contains the logic to memory-map a binary file of recorded target trajectories. The file
+ *              is never read into the heap, waypoints are read straight from the mapping (paged in by the operating
+ *              system on demand), so tens of thousands of recorded tracks can be played back at once.
+ *
+ *              File layout (native byte order):
+ *                 header:      char magic[8] = "RSIMWPT1", uint32 version (1), uint32 trackCount, uint64 reserved
+ *                 track index: trackCount x {uint64 firstWaypoint, uint64 waypointCount, double rcs(dBm^2), uint64 reserved}
+ *                 waypoints:   all tracks' waypoints back to back, each {double time(s), double xyz[3](m), double vel[3](m/s)}
+ *              Waypoints of a track must be sorted by increasing time.
+ *///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WAYPOINTFILE_H
+#define WAYPOINTFILE_H
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+//Single recorded waypoint
+struct waypoint {
+   double time;      //Simulation time of waypoint. (seconds)
+   double xyz[3];    //Cartesian position. 0 = x. 1 = y. 2 = z. (meters)
+   double vel[3];    //Cartesian velocity. 0 = x. 1 = y. 2 = z. (m/s)
+};
+
+//Track index entry of waypoint file
+struct waypointTrackIndex {
+   uint64_t firstWaypoint; //Index of track's first waypoint in waypoint table
+   uint64_t waypointCount; //Amount of waypoints in track
+   double rcs;             //Target RCS. (dBm^2)
+   uint64_t reserved;
+};
+
+//Header of waypoint file
+struct waypointFileHeader {
+   char magic[8];          //"RSIMWPT1"
+   uint32_t version;       //File version
+   uint32_t trackCount;    //Amount of recorded tracks
+   uint64_t reserved;
+};
+
+class waypointFile {
+   public:
+      waypointFile(){
+         mapping = NULL;
+         mappingSize = 0;
+         trackIndex = NULL;
+         waypointTable = NULL;
+         trackCount = 0;
+      }
+      ~waypointFile(){
+         closeFile();
+      }
+
+      //Memory-maps a waypoint file and validates its header and track index. Additionally checks for errors in opening file
+      void openFile(string fileName){
+         closeFile();
+         int fileDescriptor = open(fileName.c_str(), O_RDONLY);
+         if(fileDescriptor < 0){
+            cout << "Error opening " << fileName;
+            exit(1);
+         }
+         struct stat fileInfo;
+         fstat(fileDescriptor, &fileInfo);
+         mappingSize = fileInfo.st_size;
+         if(mappingSize < sizeof(waypointFileHeader)){
+            cout << "Error, " << fileName << " is not a waypoint file" << endl;
+            exit(1);
+         }
+         mapping = (char*)mmap(NULL, mappingSize, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+         close(fileDescriptor); //Mapping stays valid after file descriptor is closed
+         if(mapping == MAP_FAILED){
+            cout << "Error mapping " << fileName << endl;
+            exit(1);
+         }
+         madvise(mapping, mappingSize, MADV_RANDOM); //Tracks are played back side by side, read-ahead is not useful
+
+         //Header and index validation
+         const waypointFileHeader* header = (const waypointFileHeader*)mapping;
+         if(memcmp(header->magic, "RSIMWPT1", 8) != 0 || header->version != 1){
+            cout << "Error, " << fileName << " is not a version 1 waypoint file" << endl;
+            exit(1);
+         }
+         trackCount = header->trackCount;
+         size_t waypointOffset = sizeof(waypointFileHeader) + trackCount*sizeof(waypointTrackIndex);
+         if(mappingSize < waypointOffset){
+            cout << "Error, " << fileName << " track index is truncated" << endl;
+            exit(1);
+         }
+         trackIndex = (const waypointTrackIndex*)(mapping + sizeof(waypointFileHeader));
+         waypointTable = (const waypoint*)(mapping + waypointOffset);
+         uint64_t waypointTotal = (mappingSize - waypointOffset) / sizeof(waypoint);
+         for(size_t track = 0; track < trackCount; track++){
+            if(trackIndex[track].waypointCount == 0 || trackIndex[track].firstWaypoint + trackIndex[track].waypointCount > waypointTotal){
+               cout << "Error, " << fileName << " track " << track << " waypoints are out of range" << endl;
+               exit(1);
+            }
+            //Trajectory interpolation divides by time between waypoints, equal or decreasing times are not a trajectory
+            const waypoint* points = waypointTable + trackIndex[track].firstWaypoint;
+            for(uint64_t pointIter = 1; pointIter < trackIndex[track].waypointCount; pointIter++){
+               if(!(points[pointIter].time > points[pointIter - 1].time)){
+                  cout << "Error, " << fileName << " track " << track << " waypoint times are not strictly increasing" << endl;
+                  exit(1);
+               }
+            }
+         }
+      }
+
+      //Unmaps waypoint file
+      void closeFile(){
+         if(mapping != NULL){
+            munmap(mapping, mappingSize);
+         }
+         mapping = NULL;
+         mappingSize = 0;
+         trackIndex = NULL;
+         waypointTable = NULL;
+         trackCount = 0;
+      }
+
+      //Gets amount of recorded tracks in file
+      size_t getTrackCount(){
+         return trackCount;
+      }
+
+      //Gets pointer to a track's first waypoint inside the mapping
+      const waypoint* getWaypoints(size_t track){
+         return waypointTable + trackIndex[track].firstWaypoint;
+      }
+
+      //Gets amount of waypoints of a track
+      size_t getWaypointCount(size_t track){
+         return trackIndex[track].waypointCount;
+      }
+
+      //Gets RCS of a track
+      //Unit: dBm^2
+      double getRCS(size_t track){
+         return trackIndex[track].rcs;
+      }
+
+      //Writes a waypoint file, used to convert recorded truth data into the playback format
+      //Inputs: tracks = waypoints of every track (strictly increasing times). rcs = RCS of every track (dBm^2)
+      static void writeFile(string fileName, const vector< vector<waypoint> > &tracks, const vector<double> &rcs){
+         ofstream outFile(fileName.c_str(), ios::binary);
+         if(!outFile.is_open()){
+            cout << "Error opening " << fileName;
+            exit(1);
+         }
+         waypointFileHeader header;
+         memset(&header, 0, sizeof(header));
+         memcpy(header.magic, "RSIMWPT1", 8);
+         header.version = 1;
+         header.trackCount = tracks.size();
+         outFile.write((const char*)&header, sizeof(header));
+
+         uint64_t firstWaypoint = 0;
+         for(size_t track = 0; track < tracks.size(); track++){
+            waypointTrackIndex index;
+            index.firstWaypoint = firstWaypoint;
+            index.waypointCount = tracks[track].size();
+            index.rcs = rcs[track];
+            index.reserved = 0;
+            outFile.write((const char*)&index, sizeof(index));
+            firstWaypoint = firstWaypoint + tracks[track].size();
+         }
+         for(size_t track = 0; track < tracks.size(); track++){
+            outFile.write((const char*)tracks[track].data(), tracks[track].size()*sizeof(waypoint));
+         }
+      }
+
+   private:
+      char* mapping;                         //Start of memory-mapped file
+      size_t mappingSize;                    //Size of mapping. (bytes)
+      const waypointTrackIndex* trackIndex;  //Track index inside mapping
+      const waypoint* waypointTable;         //Waypoint table inside mapping
+      size_t trackCount;                     //Amount of recorded tracks
+};
+
+#endif